@@ -0,0 +1,393 @@
+#ifndef CONCURRENT_SINGLY_LINKED_LIST_H
+#define CONCURRENT_SINGLY_LINKED_LIST_H
+
+#include "fixed_block_memory_resource.h"
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+// Односвязный список для сценария "много читателей, редкие записи".
+// Читатели обходят список без блокировок и без атомарных RMW-операций: каждый
+// зарегистрированный читатель публикует эпоху в собственной кэш-линии.
+// Писатели сериализуются мьютексом, публикуют изменения атомарной записью
+// указателя, а удалённые узлы возвращают в memory resource только после того,
+// как все читатели, которые могли их видеть, покинули свою эпоху.
+// Memory resource используется только писателями (под мьютексом).
+template<typename T, typename Allocator = std::pmr::polymorphic_allocator<T>>
+class ConcurrentSinglyLinkedList {
+private:
+    struct Node {
+        T data;
+        std::atomic<Node*> next;
+        Node* retired_next;
+        std::uint64_t retire_epoch;
+
+        Node(const T& value, Node* nxt = nullptr)
+            : data(value), next(nxt), retired_next(nullptr), retire_epoch(0) {}
+
+        Node(T&& value, Node* nxt = nullptr)
+            : data(std::move(value)), next(nxt), retired_next(nullptr), retire_epoch(0) {}
+    };
+
+    struct alignas(64) ReaderSlot {
+        std::atomic<std::uint64_t> epoch;
+        std::atomic<bool> in_use;
+
+        ReaderSlot() : epoch(inactive), in_use(false) {}
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+    static constexpr std::uint64_t inactive = std::numeric_limits<std::uint64_t>::max();
+
+    std::atomic<Node*> head;
+    Node* tail;
+    std::atomic<size_t> size_;
+    NodeAllocator alloc;
+
+    mutable std::mutex write_mutex;
+    std::atomic<std::uint64_t> global_epoch;
+    Node* retired;
+    size_t retired_count_;
+
+    std::unique_ptr<ReaderSlot[]> slots;
+    size_t max_readers_;
+
+public:
+    class const_iterator;
+    class ReadGuard;
+
+    // Дескриптор читателя: владеет слотом эпохи и используется одним потоком.
+    class Reader {
+    private:
+        const ConcurrentSinglyLinkedList* list;
+        ReaderSlot* slot;
+        size_t depth;
+
+        friend class ConcurrentSinglyLinkedList;
+        friend class ReadGuard;
+
+        Reader(const ConcurrentSinglyLinkedList* list, ReaderSlot* slot)
+            : list(list), slot(slot), depth(0) {}
+
+    public:
+        Reader(Reader&& other) noexcept
+            : list(other.list), slot(other.slot), depth(other.depth) {
+            other.slot = nullptr;
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+        Reader& operator=(Reader&&) = delete;
+
+        ~Reader() {
+            if (slot) {
+                slot->epoch.store(inactive, std::memory_order_release);
+                slot->in_use.store(false, std::memory_order_release);
+            }
+        }
+
+        ReadGuard pin() {
+            return ReadGuard(*this);
+        }
+    };
+
+    // Пока охранник жив, узлы, видимые через begin()/end(), не освобождаются.
+    class ReadGuard {
+    private:
+        Reader* reader;
+
+        friend class Reader;
+
+        explicit ReadGuard(Reader& r) : reader(&r) {
+            if (reader->depth++ == 0) {
+                reader->slot->epoch.store(reader->list->global_epoch.load(std::memory_order_acquire),
+                                          std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+    public:
+        ReadGuard(ReadGuard&& other) noexcept : reader(other.reader) {
+            other.reader = nullptr;
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ReadGuard& operator=(ReadGuard&&) = delete;
+
+        ~ReadGuard() {
+            if (reader && --reader->depth == 0) {
+                reader->slot->epoch.store(inactive, std::memory_order_release);
+            }
+        }
+
+        const_iterator begin() const {
+            return const_iterator(reader->list->head.load(std::memory_order_acquire));
+        }
+
+        const_iterator end() const {
+            return const_iterator(nullptr);
+        }
+
+        bool empty() const {
+            return begin() == end();
+        }
+    };
+
+    explicit ConcurrentSinglyLinkedList(const Allocator& alloc = Allocator(), size_t max_readers = 64)
+        : head(nullptr), tail(nullptr), size_(0), alloc(alloc), global_epoch(1),
+          retired(nullptr), retired_count_(0),
+          slots(new ReaderSlot[max_readers]), max_readers_(max_readers) {}
+
+    ConcurrentSinglyLinkedList(const ConcurrentSinglyLinkedList&) = delete;
+    ConcurrentSinglyLinkedList& operator=(const ConcurrentSinglyLinkedList&) = delete;
+
+    // Вызывающая сторона гарантирует, что активных читателей больше нет.
+    ~ConcurrentSinglyLinkedList() {
+        DeallocationBatch batch(fixed_block_resource_of(alloc));
+        Node* current = head.load(std::memory_order_relaxed);
+        while (current != nullptr) {
+            Node* next = current->next.load(std::memory_order_relaxed);
+            release_node(current, batch);
+            current = next;
+        }
+        while (retired != nullptr) {
+            Node* next = retired->retired_next;
+            release_node(retired, batch);
+            retired = next;
+        }
+        batch.flush();
+    }
+
+    Reader register_reader() const {
+        for (size_t i = 0; i < max_readers_; ++i) {
+            bool expected = false;
+            if (!slots[i].in_use.load(std::memory_order_relaxed) &&
+                slots[i].in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return Reader(this, &slots[i]);
+            }
+        }
+        throw std::length_error("Too many readers");
+    }
+
+    void push_back(const T& value) {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        link_back(allocate_node(value));
+    }
+
+    void push_back(T&& value) {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        link_back(allocate_node(std::move(value)));
+    }
+
+    void push_front(const T& value) {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        link_front(allocate_node(value));
+    }
+
+    void push_front(T&& value) {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        link_front(allocate_node(std::move(value)));
+    }
+
+    void pop_front() {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        Node* old_head = head.load(std::memory_order_relaxed);
+        if (old_head == nullptr) {
+            throw std::out_of_range("List is empty");
+        }
+        head.store(old_head->next.load(std::memory_order_relaxed), std::memory_order_release);
+        if (tail == old_head) {
+            tail = nullptr;
+        }
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        retire(old_head);
+        collect();
+    }
+
+    template<typename Pred>
+    size_t remove_if(Pred pred) {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        size_t removed = 0;
+        Node* prev = nullptr;
+        Node* current = head.load(std::memory_order_relaxed);
+        while (current != nullptr) {
+            Node* next = current->next.load(std::memory_order_relaxed);
+            if (pred(current->data)) {
+                if (prev) {
+                    prev->next.store(next, std::memory_order_release);
+                } else {
+                    head.store(next, std::memory_order_release);
+                }
+                if (tail == current) {
+                    tail = prev;
+                }
+                retire(current);
+                ++removed;
+            } else {
+                prev = current;
+            }
+            current = next;
+        }
+        size_.fetch_sub(removed, std::memory_order_relaxed);
+        if (removed > 0) {
+            collect();
+        }
+        return removed;
+    }
+
+    void clear() {
+        remove_if([](const T&) { return true; });
+    }
+
+    // Повторная попытка освободить узлы, ожидающие окончания эпохи.
+    void reclaim() {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        collect();
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    size_t retired_count() const {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        return retired_count_;
+    }
+
+private:
+    void link_back(Node* new_node) {
+        if (tail) {
+            tail->next.store(new_node, std::memory_order_release);
+        } else {
+            head.store(new_node, std::memory_order_release);
+        }
+        tail = new_node;
+        size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void link_front(Node* new_node) {
+        Node* old_head = head.load(std::memory_order_relaxed);
+        new_node->next.store(old_head, std::memory_order_relaxed);
+        head.store(new_node, std::memory_order_release);
+        if (old_head == nullptr) {
+            tail = new_node;
+        }
+        size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Узел уже недостижим из head; его next не трогаем, так как читатели,
+    // стоящие на нём, должны суметь продолжить обход.
+    void retire(Node* node) {
+        node->retire_epoch = global_epoch.load(std::memory_order_relaxed);
+        node->retired_next = retired;
+        retired = node;
+        ++retired_count_;
+    }
+
+    void collect() {
+        global_epoch.store(global_epoch.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::uint64_t min_epoch = inactive;
+        for (size_t i = 0; i < max_readers_; ++i) {
+            std::uint64_t epoch = slots[i].epoch.load(std::memory_order_acquire);
+            if (epoch < min_epoch) {
+                min_epoch = epoch;
+            }
+        }
+
+        DeallocationBatch batch(fixed_block_resource_of(alloc));
+        Node** link = &retired;
+        while (*link != nullptr) {
+            Node* node = *link;
+            if (node->retire_epoch < min_epoch) {
+                *link = node->retired_next;
+                release_node(node, batch);
+                --retired_count_;
+            } else {
+                link = &node->retired_next;
+            }
+        }
+        batch.flush();
+    }
+
+    template<typename U>
+    Node* allocate_node(U&& value) {
+        Node* new_node = alloc.allocate(1);
+        try {
+            std::allocator_traits<NodeAllocator>::construct(alloc, new_node, std::forward<U>(value));
+        } catch (...) {
+            alloc.deallocate(new_node, 1);
+            throw;
+        }
+        return new_node;
+    }
+
+    void release_node(Node* node, DeallocationBatch& batch) {
+        std::allocator_traits<NodeAllocator>::destroy(alloc, node);
+        if (!batch.add(node)) {
+            alloc.deallocate(node, 1);
+        }
+    }
+
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using const_pointer = const T*;
+    using const_reference = const T&;
+
+    class const_iterator {
+    protected:
+        Node* current;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        constexpr const_iterator() noexcept : current(nullptr) {}
+        constexpr const_iterator(Node* node) noexcept : current(node) {}
+
+        const_iterator& operator++() noexcept {
+            if (current) current = current->next.load(std::memory_order_acquire);
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        reference operator*() const noexcept {
+            return current->data;
+        }
+
+        pointer operator->() const noexcept {
+            return &current->data;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept {
+            return current == other.current;
+        }
+
+        bool operator!=(const const_iterator& other) const noexcept {
+            return !(*this == other);
+        }
+    };
+};
+
+#endif
@@ -0,0 +1,266 @@
+#ifndef EXPANDABLE_BUFFER_H
+#define EXPANDABLE_BUFFER_H
+
+#include "fixed_block_memory_resource.h"
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+// Динамический массив поверх polymorphic_allocator. Если память берётся из
+// FixedBlockMemoryResource, рост сначала пробует try_expand (блок растёт на
+// месте за счёт соседнего свободного), а shrink_to_fit возвращает хвост через
+// shrink. Перевыделение с переносом элементов - только запасной путь.
+template<typename T, typename Allocator = std::pmr::polymorphic_allocator<T>>
+class ExpandableBuffer {
+private:
+    T* data_;
+    size_t size_;
+    size_t capacity_;
+    Allocator alloc;
+
+public:
+    explicit ExpandableBuffer(const Allocator& alloc = Allocator())
+        : data_(nullptr), size_(0), capacity_(0), alloc(alloc) {}
+
+    ExpandableBuffer(const ExpandableBuffer& other)
+        : data_(nullptr), size_(0), capacity_(0), alloc(other.alloc) {
+        reserve(other.size_);
+        for (size_t i = 0; i < other.size_; ++i) {
+            push_back(other.data_[i]);
+        }
+    }
+
+    ExpandableBuffer(ExpandableBuffer&& other) noexcept
+        : data_(other.data_), size_(other.size_), capacity_(other.capacity_), alloc(std::move(other.alloc)) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    ~ExpandableBuffer() {
+        clear();
+        release_storage();
+    }
+
+    ExpandableBuffer& operator=(const ExpandableBuffer& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            for (size_t i = 0; i < other.size_; ++i) {
+                push_back(other.data_[i]);
+            }
+        }
+        return *this;
+    }
+
+    // Хранилище забирается только при равных аллокаторах; иначе элементы
+    // переносятся по одному в память этого буфера.
+    ExpandableBuffer& operator=(ExpandableBuffer&& other) {
+        if (this != &other) {
+            clear();
+            if (alloc == other.alloc) {
+                release_storage();
+                data_ = other.data_;
+                size_ = other.size_;
+                capacity_ = other.capacity_;
+
+                other.data_ = nullptr;
+                other.size_ = 0;
+                other.capacity_ = 0;
+            } else {
+                reserve(other.size_);
+                for (size_t i = 0; i < other.size_; ++i) {
+                    push_back(std::move(other.data_[i]));
+                }
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    void push_back(const T& value) {
+        if (size_ == capacity_) {
+            T copy(value);
+            grow(size_ + 1);
+            std::allocator_traits<Allocator>::construct(alloc, data_ + size_, std::move(copy));
+        } else {
+            std::allocator_traits<Allocator>::construct(alloc, data_ + size_, value);
+        }
+        size_++;
+    }
+
+    void push_back(T&& value) {
+        if (size_ == capacity_) {
+            T moved(std::move(value));
+            grow(size_ + 1);
+            std::allocator_traits<Allocator>::construct(alloc, data_ + size_, std::move(moved));
+        } else {
+            std::allocator_traits<Allocator>::construct(alloc, data_ + size_, std::move(value));
+        }
+        size_++;
+    }
+
+    void pop_back() {
+        if (empty()) {
+            throw std::out_of_range("Buffer is empty");
+        }
+        size_--;
+        std::allocator_traits<Allocator>::destroy(alloc, data_ + size_);
+    }
+
+    void reserve(size_t count) {
+        if (count > max_size()) {
+            throw std::length_error("Buffer size exceeds max_size");
+        }
+        if (count > capacity_) {
+            reallocate_or_expand(count);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (size_ == capacity_) {
+            return;
+        }
+        if (size_ == 0) {
+            release_storage();
+            return;
+        }
+        FixedBlockMemoryResource* resource = fixed_block_resource_of(alloc);
+        if (resource) {
+            resource->shrink(data_, capacity_ * sizeof(T), size_ * sizeof(T));
+            capacity_ = size_;
+        } else {
+            relocate(size_);
+        }
+    }
+
+    void clear() noexcept {
+        while (size_ > 0) {
+            size_--;
+            std::allocator_traits<Allocator>::destroy(alloc, data_ + size_);
+        }
+    }
+
+    T& operator[](size_t index) {
+        return data_[index];
+    }
+
+    const T& operator[](size_t index) const {
+        return data_[index];
+    }
+
+    T& at(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data_[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data_[index];
+    }
+
+    T& front() {
+        if (empty()) {
+            throw std::out_of_range("Buffer is empty");
+        }
+        return data_[0];
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::out_of_range("Buffer is empty");
+        }
+        return data_[size_ - 1];
+    }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    // Наибольшая ёмкость, для которой capacity * sizeof(T) не переполняется.
+    size_t max_size() const noexcept {
+        return std::allocator_traits<Allocator>::max_size(alloc);
+    }
+
+    T* begin() noexcept { return data_; }
+    T* end() noexcept { return data_ + size_; }
+    const T* begin() const noexcept { return data_; }
+    const T* end() const noexcept { return data_ + size_; }
+
+private:
+    void grow(size_t min_capacity) {
+        if (min_capacity > max_size()) {
+            throw std::length_error("Buffer size exceeds max_size");
+        }
+        size_t new_capacity = capacity_ == 0 ? 1 : capacity_ * 2;
+        if (capacity_ > max_size() / 2) {
+            new_capacity = max_size();
+        }
+        if (new_capacity < min_capacity) {
+            new_capacity = min_capacity;
+        }
+        reallocate_or_expand(new_capacity);
+    }
+
+    void reallocate_or_expand(size_t new_capacity) {
+        FixedBlockMemoryResource* resource = fixed_block_resource_of(alloc);
+        if (resource && data_ &&
+            resource->try_expand(data_, capacity_ * sizeof(T), new_capacity * sizeof(T))) {
+            capacity_ = new_capacity;
+            return;
+        }
+        relocate(new_capacity);
+    }
+
+    void relocate(size_t new_capacity) {
+        if (new_capacity > max_size()) {
+            throw std::length_error("Buffer size exceeds max_size");
+        }
+        T* new_data = alloc.allocate(new_capacity);
+        size_t moved = 0;
+        try {
+            for (; moved < size_; ++moved) {
+                std::allocator_traits<Allocator>::construct(alloc, new_data + moved,
+                                                            std::move_if_noexcept(data_[moved]));
+            }
+        } catch (...) {
+            while (moved > 0) {
+                std::allocator_traits<Allocator>::destroy(alloc, new_data + --moved);
+            }
+            alloc.deallocate(new_data, new_capacity);
+            throw;
+        }
+
+        size_t count = size_;
+        clear();
+        release_storage();
+        data_ = new_data;
+        size_ = count;
+        capacity_ = new_capacity;
+    }
+
+    void release_storage() {
+        if (data_) {
+            alloc.deallocate(data_, capacity_);
+        }
+        data_ = nullptr;
+        capacity_ = 0;
+    }
+};
+
+#endif
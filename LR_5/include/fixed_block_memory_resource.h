@@ -2,34 +2,185 @@
 #define FIXED_BLOCK_MEMORY_RESOURCE_H
 
 #include <memory_resource>
-#include <list>
+#include <vector>
 #include <cstddef>
+#include <cstring>
 
-struct MemoryBlock {
-    void* ptr;
-    std::size_t size;
-    bool is_free;
-
-    MemoryBlock(void* p, std::size_t s, bool f) : ptr(p), size(s), is_free(f) {}
-};
-
-class FixedBlockMemoryResource : public std::pmr::memory_resource {
+// Класс final: DeallocationBatch, try_expand и shrink работают с метаданными
+// блоков напрямую, минуя do_allocate/do_deallocate, поэтому их переопределения
+// в наследнике молча пропускались бы.
+class FixedBlockMemoryResource final : public std::pmr::memory_resource {
 private:
     char* pool;
     std::size_t pool_size;
-    std::list<MemoryBlock> blocks;
 
-    std::list<MemoryBlock>::iterator find_free_block(std::size_t bytes);
+    // Метаданные блоков хранятся как структура массивов, упорядоченная по адресу.
+    // free_sizes[i] равен sizes[i] для свободного блока и 0 для занятого, поэтому
+    // проверка "свободен и помещается" сводится к одному сравнению на элемент.
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> sizes;
+    std::vector<std::size_t> free_sizes;
+
+    // Кадры: при первом push_frame под арену резервируется блок заданного размера
+    // (по умолчанию половина самого большого свободного), внутри которого FrameResource
+    // выделяет память сдвигом указателя bump.
+    // frame_marks хранит значения bump на момент открытия каждого кадра.
+    std::vector<std::size_t> frame_marks;
+    bool has_arena;
+    std::size_t arena_offset;
+    std::size_t arena_end;
+    std::size_t bump;
+
+    std::size_t block_count() const noexcept { return offsets.size(); }
+    std::size_t find_free_block(std::size_t bytes) const noexcept;
+    std::size_t find_allocated_block(void* ptr) const;
+    std::size_t find_allocated_block(void* ptr, std::size_t size) const;
+    void insert_block(std::size_t index, std::size_t offset, std::size_t size, bool is_free);
+    void erase_block(std::size_t index);
     void merge_free_blocks();
+    void coalesce_around(std::size_t index);
+    bool is_arena_block(std::size_t index) const noexcept;
+    void* allocate_in_frame(std::size_t bytes, std::size_t alignment);
+
+    friend class FrameResource;
 
 public:
     explicit FixedBlockMemoryResource(std::size_t size);
     ~FixedBlockMemoryResource() override;
 
+    // Освобождает сразу count блоков: указатели сортируются по адресу (массив
+    // ptrs переупорядочивается), помечаются свободными за один проход, после
+    // чего соседние свободные блоки сливаются один раз. При ошибке в любом
+    // указателе ничего не освобождается.
+    void deallocate_batch(void** ptrs, std::size_t count);
+
+    // То же для цепочки блоков, где первые sizeof(void*) байт каждого блока
+    // хранят указатель на следующий (см. DeallocationBatch).
+    void deallocate_chain(void* first);
+
+    // Пытается увеличить блок ptr до new_size байт на месте, забирая начало
+    // соседнего свободного блока. При неудаче блок не меняется и возвращается false;
+    // new_size меньше текущего размера выполняется как shrink.
+    // old_size должен совпадать с размером, с которым блок был выделен.
+    bool try_expand(void* ptr, std::size_t old_size, std::size_t new_size);
+
+    // Уменьшает блок ptr размером old_size до new_size байт, возвращая хвост
+    // в свободную память.
+    void shrink(void* ptr, std::size_t old_size, std::size_t new_size);
+
+    // Кадры затрагивают только память, выделенную через FrameResource: обычные
+    // выделения из этого ресурса и во время кадра получают отдельные блоки вне арены.
+    // pop_frame за O(1) освобождает всё, выделенное через FrameResource после
+    // соответствующего push_frame. arena_size учитывается только внешним кадром.
+    // Арена занята целиком до закрытия внешнего кадра: чем она больше, тем меньше
+    // памяти остаётся обычным выделениям. По умолчанию (arena_size == 0) берётся
+    // половина самого большого свободного блока; если известен объём временных
+    // данных запроса, лучше передать его явно.
+    void push_frame(std::size_t arena_size = 0);
+    void pop_frame();
+    std::size_t frame_depth() const noexcept { return frame_marks.size(); }
+
 protected:
     void* do_allocate(std::size_t bytes, std::size_t alignment) override;
     void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
     bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
 };
 
+template<typename Allocator>
+FixedBlockMemoryResource* fixed_block_resource_of(const Allocator&) noexcept {
+    return nullptr;
+}
+
+template<typename U>
+FixedBlockMemoryResource* fixed_block_resource_of(const std::pmr::polymorphic_allocator<U>& alloc) noexcept {
+    return dynamic_cast<FixedBlockMemoryResource*>(alloc.resource());
+}
+
+class FrameGuard {
+private:
+    FixedBlockMemoryResource& resource;
+
+public:
+    explicit FrameGuard(FixedBlockMemoryResource& resource, std::size_t arena_size = 0)
+        : resource(resource) {
+        resource.push_frame(arena_size);
+    }
+
+    ~FrameGuard() {
+        resource.pop_frame();
+    }
+
+    FrameGuard(const FrameGuard&) = delete;
+    FrameGuard& operator=(const FrameGuard&) = delete;
+};
+
+// Ресурс для временных контейнеров запроса: выделяет память в арене открытых
+// кадров parent, освобождение - no-op (как у std::pmr::monotonic_buffer_resource).
+// Контейнер не должен пережить кадр, в котором он рос: после pop_frame эта память
+// снова выдаётся следующим выделениям, и его узлы будут перезаписаны.
+class FrameResource : public std::pmr::memory_resource {
+private:
+    FixedBlockMemoryResource& parent;
+
+public:
+    explicit FrameResource(FixedBlockMemoryResource& parent) noexcept : parent(parent) {}
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        return parent.allocate_in_frame(bytes, alignment);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        const FrameResource* frame = dynamic_cast<const FrameResource*>(&other);
+        return frame != nullptr && &frame->parent == &parent;
+    }
+};
+
+// Собирает освобождаемые блоки в цепочку, хранящуюся в самих мёртвых блоках
+// (первые sizeof(void*) байт каждого блока), и отдаёт их ресурсу одним
+// deallocate_chain: все блоки помечаются свободными, слияние выполняется один раз.
+// Если resource == nullptr, add() возвращает false и вызывающая сторона
+// освобождает память обычным способом.
+class DeallocationBatch {
+private:
+    FixedBlockMemoryResource* resource;
+    void* chain;
+
+public:
+    explicit DeallocationBatch(FixedBlockMemoryResource* resource) noexcept
+        : resource(resource), chain(nullptr) {}
+
+    DeallocationBatch(const DeallocationBatch&) = delete;
+    DeallocationBatch& operator=(const DeallocationBatch&) = delete;
+
+    // Досрочный выход без flush() не должен терять блоки; ошибки здесь
+    // подавляются, чтобы не бросать исключение из деструктора.
+    ~DeallocationBatch() {
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+
+    // Блок ptr должен быть не меньше sizeof(void*) и больше не использоваться.
+    bool add(void* ptr) noexcept {
+        if (resource == nullptr) {
+            return false;
+        }
+        std::memcpy(ptr, &chain, sizeof(chain));
+        chain = ptr;
+        return true;
+    }
+
+    void flush() {
+        if (chain != nullptr) {
+            void* first = chain;
+            chain = nullptr;
+            resource->deallocate_chain(first);
+        }
+    }
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,358 @@
+#ifndef INDEXED_SINGLY_LINKED_LIST_H
+#define INDEXED_SINGLY_LINKED_LIST_H
+
+#include "singly_linked_list.h"
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+struct IdentityKey {
+    template<typename U>
+    const U& operator()(const U& value) const noexcept {
+        return value;
+    }
+};
+
+// Односвязный список с уникальными ключами и хеш-индексом "ключ -> предыдущий узел"
+// (открытая адресация, линейное пробирование). Хеш перед выбором позиции
+// перемешивается умножением Фибоначчи: std::hash для целых - тождественная
+// функция, и ключи с шагом, кратным ёмкости, иначе попадали бы в один кластер.
+// Индекс выделяется из того же
+// memory resource, что и узлы. find / contains / erase по ключу работают за
+// ожидаемое O(1), порядок вставки сохраняется.
+// Ключ элемента (KeyOf(value)) нельзя изменять через итератор.
+template<typename T,
+         typename KeyOf = IdentityKey,
+         typename Hash = std::hash<std::decay_t<std::invoke_result_t<const KeyOf&, const T&>>>,
+         typename KeyEqual = std::equal_to<>,
+         typename Allocator = std::pmr::polymorphic_allocator<T>>
+class IndexedSinglyLinkedList : private SinglyLinkedList<T, Allocator> {
+private:
+    using Base = SinglyLinkedList<T, Allocator>;
+    using Node = typename Base::Node;
+
+    using Base::head;
+    using Base::tail;
+    using Base::size_;
+
+public:
+    using key_type = std::decay_t<std::invoke_result_t<const KeyOf&, const T&>>;
+
+    using typename Base::value_type;
+    using typename Base::difference_type;
+    using typename Base::pointer;
+    using typename Base::reference;
+    using typename Base::const_pointer;
+    using typename Base::const_reference;
+    using typename Base::iterator;
+    using typename Base::const_iterator;
+
+    using Base::front;
+    using Base::back;
+    using Base::empty;
+    using Base::size;
+    using Base::begin;
+    using Base::end;
+    using Base::cbegin;
+    using Base::cend;
+
+private:
+    // hash хранит уже перемешанное значение; позиция - его старшие биты.
+    struct Slot {
+        Node* node;
+        Node* prev;
+        std::size_t hash;
+    };
+
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+
+    static constexpr std::size_t min_capacity = 8;
+    static constexpr std::size_t hash_bits = std::numeric_limits<std::size_t>::digits;
+    static constexpr std::size_t fibonacci_multiplier =
+        hash_bits > 32 ? static_cast<std::size_t>(0x9E3779B97F4A7C15ull) : static_cast<std::size_t>(0x9E3779B9u);
+
+    SlotAllocator slot_alloc;
+    Slot* slots;
+    std::size_t capacity_;
+    std::size_t shift_;
+    KeyOf key_of;
+    Hash hasher;
+    KeyEqual key_eq;
+
+public:
+    explicit IndexedSinglyLinkedList(const Allocator& alloc = Allocator())
+        : Base(alloc), slot_alloc(alloc), slots(nullptr), capacity_(0), shift_(hash_bits) {}
+
+    IndexedSinglyLinkedList(const IndexedSinglyLinkedList& other)
+        : Base(Allocator(other.slot_alloc)), slot_alloc(other.slot_alloc), slots(nullptr), capacity_(0),
+          shift_(hash_bits), key_of(other.key_of), hasher(other.hasher), key_eq(other.key_eq) {
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    IndexedSinglyLinkedList(IndexedSinglyLinkedList&& other) noexcept
+        : Base(std::move(other)), slot_alloc(std::move(other.slot_alloc)), slots(other.slots),
+          capacity_(other.capacity_), shift_(other.shift_), key_of(std::move(other.key_of)),
+          hasher(std::move(other.hasher)), key_eq(std::move(other.key_eq)) {
+        other.slots = nullptr;
+        other.capacity_ = 0;
+        other.shift_ = hash_bits;
+    }
+
+    ~IndexedSinglyLinkedList() {
+        release_index();
+    }
+
+    IndexedSinglyLinkedList& operator=(const IndexedSinglyLinkedList& other) {
+        if (this != &other) {
+            clear();
+            key_of = other.key_of;
+            hasher = other.hasher;
+            key_eq = other.key_eq;
+            for (const T& value : other) {
+                push_back(value);
+            }
+        }
+        return *this;
+    }
+
+    // Как и в SinglyLinkedList, узлы и индекс забираются только при равных
+    // аллокаторах; иначе элементы переносятся по одному.
+    IndexedSinglyLinkedList& operator=(IndexedSinglyLinkedList&& other) {
+        if (this != &other) {
+            clear();
+            key_of = other.key_of;
+            hasher = other.hasher;
+            key_eq = other.key_eq;
+            if (slot_alloc == other.slot_alloc) {
+                release_index();
+                Base::operator=(std::move(other));
+                slots = other.slots;
+                capacity_ = other.capacity_;
+                shift_ = other.shift_;
+                other.slots = nullptr;
+                other.capacity_ = 0;
+                other.shift_ = hash_bits;
+            } else {
+                for (T& value : static_cast<Base&>(other)) {
+                    push_back(std::move(value));
+                }
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    std::pair<iterator, bool> push_back(const T& value) {
+        return insert_back(value);
+    }
+
+    std::pair<iterator, bool> push_back(T&& value) {
+        return insert_back(std::move(value));
+    }
+
+    std::pair<iterator, bool> push_front(const T& value) {
+        return insert_front(value);
+    }
+
+    std::pair<iterator, bool> push_front(T&& value) {
+        return insert_front(std::move(value));
+    }
+
+    void pop_front() {
+        if (empty()) {
+            throw std::out_of_range("List is empty");
+        }
+        erase_at(slot_of(head));
+    }
+
+    void pop_back() {
+        if (empty()) {
+            throw std::out_of_range("List is empty");
+        }
+        erase_at(slot_of(tail));
+    }
+
+    iterator find(const key_type& key) {
+        std::size_t pos = find_slot(key, hash_of(key));
+        return pos == capacity_ ? end() : iterator(slots[pos].node);
+    }
+
+    const_iterator find(const key_type& key) const {
+        std::size_t pos = find_slot(key, hash_of(key));
+        return pos == capacity_ ? end() : const_iterator(slots[pos].node);
+    }
+
+    bool contains(const key_type& key) const {
+        return find_slot(key, hash_of(key)) != capacity_;
+    }
+
+    bool erase(const key_type& key) {
+        std::size_t pos = find_slot(key, hash_of(key));
+        if (pos == capacity_) {
+            return false;
+        }
+        erase_at(pos);
+        return true;
+    }
+
+    void clear() {
+        Base::clear();
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            slots[i] = Slot{nullptr, nullptr, 0};
+        }
+    }
+
+private:
+    template<typename U>
+    std::pair<iterator, bool> insert_back(U&& value) {
+        const key_type& key = key_of(value);
+        std::size_t hash = hash_of(key);
+        std::size_t pos = find_slot(key, hash);
+        if (pos != capacity_) {
+            return {iterator(slots[pos].node), false};
+        }
+
+        reserve_index(size_ + 1);
+        Node* prev = tail;
+        Base::push_back(std::forward<U>(value));
+        index_insert(tail, prev, hash);
+        return {iterator(tail), true};
+    }
+
+    template<typename U>
+    std::pair<iterator, bool> insert_front(U&& value) {
+        const key_type& key = key_of(value);
+        std::size_t hash = hash_of(key);
+        std::size_t pos = find_slot(key, hash);
+        if (pos != capacity_) {
+            return {iterator(slots[pos].node), false};
+        }
+
+        reserve_index(size_ + 1);
+        Node* old_head = head;
+        Base::push_front(std::forward<U>(value));
+        if (old_head) {
+            slots[slot_of(old_head)].prev = head;
+        }
+        index_insert(head, nullptr, hash);
+        return {iterator(head), true};
+    }
+
+    void erase_at(std::size_t pos) {
+        Node* node = slots[pos].node;
+        Node* prev = slots[pos].prev;
+        Node* next = node->next;
+
+        if (prev) {
+            prev->next = next;
+        } else {
+            head = next;
+        }
+        if (tail == node) {
+            tail = prev;
+        }
+
+        index_erase(pos);
+        if (next) {
+            slots[slot_of(next)].prev = prev;
+        }
+
+        Base::destroy_node(node);
+        size_--;
+    }
+
+    std::size_t find_slot(const key_type& key, std::size_t hash) const {
+        if (capacity_ == 0) {
+            return capacity_;
+        }
+        std::size_t mask = capacity_ - 1;
+        for (std::size_t pos = home_slot(hash); slots[pos].node != nullptr; pos = (pos + 1) & mask) {
+            if (slots[pos].hash == hash && key_eq(key_of(slots[pos].node->data), key)) {
+                return pos;
+            }
+        }
+        return capacity_;
+    }
+
+    std::size_t hash_of(const key_type& key) const {
+        return static_cast<std::size_t>(hasher(key)) * fibonacci_multiplier;
+    }
+
+    std::size_t home_slot(std::size_t hash) const noexcept {
+        return hash >> shift_;
+    }
+
+    std::size_t slot_of(Node* node) const {
+        const key_type& key = key_of(node->data);
+        return find_slot(key, hash_of(key));
+    }
+
+    void index_insert(Node* node, Node* prev, std::size_t hash) {
+        std::size_t mask = capacity_ - 1;
+        std::size_t pos = home_slot(hash);
+        while (slots[pos].node != nullptr) {
+            pos = (pos + 1) & mask;
+        }
+        slots[pos] = Slot{node, prev, hash};
+    }
+
+    // Удаление без "надгробий": последующие элементы кластера сдвигаются назад.
+    void index_erase(std::size_t pos) {
+        std::size_t mask = capacity_ - 1;
+        std::size_t hole = pos;
+        for (std::size_t next = (hole + 1) & mask; slots[next].node != nullptr; next = (next + 1) & mask) {
+            std::size_t home = home_slot(slots[next].hash);
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                slots[hole] = slots[next];
+                hole = next;
+            }
+        }
+        slots[hole] = Slot{nullptr, nullptr, 0};
+    }
+
+    void reserve_index(std::size_t count) {
+        if (count * 4 <= capacity_ * 3) {
+            return;
+        }
+        std::size_t new_capacity = capacity_ == 0 ? min_capacity : capacity_ * 2;
+        while (count * 4 > new_capacity * 3) {
+            new_capacity *= 2;
+        }
+
+        Slot* new_slots = slot_alloc.allocate(new_capacity);
+        std::uninitialized_fill_n(new_slots, new_capacity, Slot{nullptr, nullptr, 0});
+
+        Slot* old_slots = slots;
+        std::size_t old_capacity = capacity_;
+        slots = new_slots;
+        capacity_ = new_capacity;
+        shift_ = hash_bits;
+        for (std::size_t bits = new_capacity; bits > 1; bits >>= 1) {
+            --shift_;
+        }
+        for (std::size_t i = 0; i < old_capacity; ++i) {
+            if (old_slots[i].node != nullptr) {
+                index_insert(old_slots[i].node, old_slots[i].prev, old_slots[i].hash);
+            }
+        }
+        if (old_slots) {
+            slot_alloc.deallocate(old_slots, old_capacity);
+        }
+    }
+
+    void release_index() {
+        if (slots) {
+            slot_alloc.deallocate(slots, capacity_);
+        }
+        slots = nullptr;
+        capacity_ = 0;
+        shift_ = hash_bits;
+    }
+};
+
+#endif
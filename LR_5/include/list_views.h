@@ -0,0 +1,345 @@
+#ifndef LIST_VIEWS_H
+#define LIST_VIEWS_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Ленивые представления (filter / transform / take / chunk) поверх любых
+// forward-диапазонов, в первую очередь SinglyLinkedList. Элементы вычисляются
+// во время единственного обхода, промежуточные списки не создаются:
+//
+//     for (int x : list | list_views::filter(is_even)
+//                       | list_views::transform(square)
+//                       | list_views::take(3)) { ... }
+namespace list_views {
+
+struct view_base {};
+
+template<typename Range>
+using iterator_t = decltype(std::begin(std::declval<Range&>()));
+
+template<typename Range>
+constexpr bool is_view_v = std::is_base_of_v<view_base, std::remove_cv_t<std::remove_reference_t<Range>>>;
+
+template<typename Iterator>
+class subrange : public view_base {
+private:
+    Iterator first;
+    Iterator last;
+
+public:
+    subrange() = default;
+    subrange(Iterator first, Iterator last) : first(first), last(last) {}
+
+    Iterator begin() const { return first; }
+    Iterator end() const { return last; }
+
+    bool empty() const { return first == last; }
+
+    std::size_t size() const {
+        return static_cast<std::size_t>(std::distance(first, last));
+    }
+};
+
+template<typename Range>
+class ref_view : public view_base {
+private:
+    Range* range;
+
+public:
+    explicit ref_view(Range& r) noexcept : range(&r) {}
+
+    iterator_t<Range> begin() const { return range->begin(); }
+    iterator_t<Range> end() const { return range->end(); }
+};
+
+template<typename Range>
+auto all(Range&& r) {
+    if constexpr (is_view_v<Range>) {
+        return std::decay_t<Range>(std::forward<Range>(r));
+    } else {
+        static_assert(std::is_lvalue_reference_v<Range>,
+                      "list_views: cannot build a view over a temporary container");
+        return ref_view<std::remove_reference_t<Range>>(r);
+    }
+}
+
+template<typename Range>
+using all_t = decltype(all(std::declval<Range>()));
+
+template<typename View, typename Pred>
+class filter_view : public view_base {
+private:
+    using base_iterator = iterator_t<const View>;
+
+    View base_;
+    Pred pred_;
+
+public:
+    class iterator {
+    private:
+        base_iterator current;
+        base_iterator last;
+        const Pred* pred;
+
+        void satisfy() {
+            while (current != last && !std::invoke(*pred, *current)) {
+                ++current;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::iterator_traits<base_iterator>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<base_iterator>::pointer;
+        using reference = typename std::iterator_traits<base_iterator>::reference;
+
+        iterator() : current(), last(), pred(nullptr) {}
+        iterator(base_iterator first, base_iterator last, const Pred* pred)
+            : current(first), last(last), pred(pred) {
+            satisfy();
+        }
+
+        reference operator*() const { return *current; }
+        pointer operator->() const { return std::addressof(*current); }
+
+        iterator& operator++() {
+            ++current;
+            satisfy();
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const { return current == other.current; }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+
+    filter_view(View base, Pred pred) : base_(std::move(base)), pred_(std::move(pred)) {}
+
+    iterator begin() const { return iterator(base_.begin(), base_.end(), &pred_); }
+    iterator end() const { return iterator(base_.end(), base_.end(), &pred_); }
+};
+
+template<typename View, typename Func>
+class transform_view : public view_base {
+private:
+    using base_iterator = iterator_t<const View>;
+
+    View base_;
+    Func func_;
+
+public:
+    class iterator {
+    private:
+        base_iterator current;
+        const Func* func;
+
+    public:
+        using reference = std::invoke_result_t<const Func&, typename std::iterator_traits<base_iterator>::reference>;
+        using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using iterator_category = std::conditional_t<std::is_reference_v<reference>,
+                                                     std::forward_iterator_tag,
+                                                     std::input_iterator_tag>;
+
+        iterator() : current(), func(nullptr) {}
+        iterator(base_iterator it, const Func* func) : current(it), func(func) {}
+
+        reference operator*() const { return std::invoke(*func, *current); }
+
+        iterator& operator++() {
+            ++current;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const { return current == other.current; }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+
+    transform_view(View base, Func func) : base_(std::move(base)), func_(std::move(func)) {}
+
+    iterator begin() const { return iterator(base_.begin(), &func_); }
+    iterator end() const { return iterator(base_.end(), &func_); }
+};
+
+template<typename View>
+class take_view : public view_base {
+private:
+    using base_iterator = iterator_t<const View>;
+
+    View base_;
+    std::size_t count_;
+
+public:
+    class iterator {
+    private:
+        base_iterator current;
+        std::size_t remaining;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::iterator_traits<base_iterator>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<base_iterator>::pointer;
+        using reference = typename std::iterator_traits<base_iterator>::reference;
+
+        iterator() : current(), remaining(0) {}
+        iterator(base_iterator it, std::size_t remaining) : current(it), remaining(remaining) {}
+
+        reference operator*() const { return *current; }
+        pointer operator->() const { return std::addressof(*current); }
+
+        iterator& operator++() {
+            ++current;
+            --remaining;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        // Итератор достиг конца, если исчерпан счётчик или базовый диапазон.
+        bool operator==(const iterator& other) const {
+            return remaining == other.remaining || current == other.current;
+        }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+
+    take_view(View base, std::size_t count) : base_(std::move(base)), count_(count) {}
+
+    iterator begin() const { return iterator(base_.begin(), count_); }
+    iterator end() const { return iterator(base_.end(), 0); }
+};
+
+template<typename View>
+class chunk_view : public view_base {
+private:
+    using base_iterator = iterator_t<const View>;
+
+    View base_;
+    std::size_t size_;
+
+public:
+    class iterator {
+    private:
+        base_iterator current;
+        base_iterator next;
+        base_iterator last;
+        std::size_t n;
+
+        base_iterator advance(base_iterator it) const {
+            for (std::size_t i = 0; i < n && it != last; ++i) {
+                ++it;
+            }
+            return it;
+        }
+
+    public:
+        using value_type = subrange<base_iterator>;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using iterator_category = std::input_iterator_tag;
+
+        iterator() : current(), next(), last(), n(0) {}
+        iterator(base_iterator it, base_iterator last, std::size_t n)
+            : current(it), next(it), last(last), n(n) {
+            next = advance(current);
+        }
+
+        reference operator*() const { return value_type(current, next); }
+
+        iterator& operator++() {
+            current = next;
+            next = advance(current);
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const { return current == other.current; }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+
+    chunk_view(View base, std::size_t size) : base_(std::move(base)), size_(size) {
+        if (size_ == 0) {
+            throw std::invalid_argument("Chunk size must be positive");
+        }
+    }
+
+    iterator begin() const { return iterator(base_.begin(), base_.end(), size_); }
+    iterator end() const { return iterator(base_.end(), base_.end(), size_); }
+};
+
+template<typename Func>
+struct adaptor_closure {
+    Func func;
+};
+
+template<typename Func>
+adaptor_closure<Func> make_adaptor(Func func) {
+    return adaptor_closure<Func>{std::move(func)};
+}
+
+template<typename Range, typename Func>
+auto operator|(Range&& r, const adaptor_closure<Func>& adaptor) {
+    return adaptor.func(std::forward<Range>(r));
+}
+
+template<typename Pred>
+auto filter(Pred pred) {
+    return make_adaptor([pred = std::move(pred)](auto&& r) {
+        using R = decltype(r);
+        return filter_view<all_t<R>, Pred>(all(std::forward<R>(r)), pred);
+    });
+}
+
+template<typename Func>
+auto transform(Func func) {
+    return make_adaptor([func = std::move(func)](auto&& r) {
+        using R = decltype(r);
+        return transform_view<all_t<R>, Func>(all(std::forward<R>(r)), func);
+    });
+}
+
+inline auto take(std::size_t count) {
+    return make_adaptor([count](auto&& r) {
+        using R = decltype(r);
+        return take_view<all_t<R>>(all(std::forward<R>(r)), count);
+    });
+}
+
+inline auto chunk(std::size_t size) {
+    return make_adaptor([size](auto&& r) {
+        using R = decltype(r);
+        return chunk_view<all_t<R>>(all(std::forward<R>(r)), size);
+    });
+}
+
+}
+
+#endif
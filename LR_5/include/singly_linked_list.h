@@ -2,12 +2,13 @@
 #define SINGLY_LINKED_LIST_H
 
 #include "fixed_block_memory_resource.h"
+#include <functional>
 #include <memory>
 #include <stdexcept>
 
 template<typename T, typename Allocator = std::pmr::polymorphic_allocator<T>>
 class SinglyLinkedList {
-private:
+protected:
     struct Node {
         T data;
         Node* next;
@@ -58,16 +59,25 @@ public:
         return *this;
     }
     
-    SinglyLinkedList& operator=(SinglyLinkedList&& other) noexcept {
+    // Узлы забираются только при равных аллокаторах; иначе элементы
+    // переносятся по одному, чтобы каждый узел освобождался своим ресурсом.
+    SinglyLinkedList& operator=(SinglyLinkedList&& other) {
         if (this != &other) {
             destroy_list();
-            head = other.head;
-            tail = other.tail;
-            size_ = other.size_;
-            
-            other.head = nullptr;
-            other.tail = nullptr;
-            other.size_ = 0;
+            if (alloc == other.alloc) {
+                head = other.head;
+                tail = other.tail;
+                size_ = other.size_;
+                
+                other.head = nullptr;
+                other.tail = nullptr;
+                other.size_ = 0;
+            } else {
+                for (auto it = other.head; it != nullptr; it = it->next) {
+                    push_back(std::move(it->data));
+                }
+                other.destroy_list();
+            }
         }
         return *this;
     }
@@ -186,14 +196,233 @@ public:
         destroy_list();
     }
     
-private:
+    void reverse() noexcept {
+        Node* prev = nullptr;
+        Node* current = head;
+        while (current != nullptr) {
+            Node* next = current->next;
+            current->next = prev;
+            prev = current;
+            current = next;
+        }
+        tail = head;
+        head = prev;
+    }
+    
+    // Удаляет подряд идущие равные элементы, возвращает число удалённых.
+    template<typename BinaryPredicate>
+    size_t unique(BinaryPredicate pred) {
+        if (size_ < 2) {
+            return 0;
+        }
+        DeallocationBatch batch(fixed_block_resource_of(alloc));
+        size_t removed = 0;
+        Node* current = head;
+        while (current->next != nullptr) {
+            Node* next = current->next;
+            if (pred(current->data, next->data)) {
+                current->next = next->next;
+                release_node(next, batch);
+                ++removed;
+            } else {
+                current = next;
+            }
+        }
+        tail = current;
+        size_ -= removed;
+        batch.flush();
+        return removed;
+    }
+    
+    size_t unique() {
+        return unique(std::equal_to<>());
+    }
+    
+    // Сливает отсортированный other в этот отсортированный список перекрытием
+    // ссылок, без выделения памяти. Равные элементы из *this идут первыми.
+    // Если comp бросает исключение, все узлы other всё равно переходят в этот
+    // список (порядок не определён), other остаётся пустым.
+    template<typename Compare>
+    void merge(SinglyLinkedList& other, Compare comp) {
+        if (this == &other || other.empty()) {
+            return;
+        }
+        if (!(alloc == other.alloc)) {
+            throw std::invalid_argument("Cannot merge lists with different allocators");
+        }
+        Node* last = other.tail;
+        if (!empty() && comp(other.tail->data, tail->data)) {
+            last = tail;
+        }
+        Node* nodes = other.head;
+        size_ += other.size_;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size_ = 0;
+        try {
+            merge_nodes(head, nodes, comp);
+        } catch (...) {
+            tail = last_node(head);
+            throw;
+        }
+        tail = last;
+    }
+    
+    void merge(SinglyLinkedList& other) {
+        merge(other, std::less<>());
+    }
+    
+    // Устойчивая восходящая сортировка слиянием, только перекрытием ссылок.
+    // Короткие серии сортируются вставками, затем сливаются через двоичный
+    // счётчик корзин, поэтому слияния работают с недавно затронутыми узлами.
+    // Если comp бросает исключение, список сохраняет все узлы в неопределённом порядке.
+    template<typename Compare>
+    void sort(Compare comp) {
+        if (size_ < 2) {
+            return;
+        }
+        constexpr size_t run_length = 16;
+        constexpr size_t max_bins = 64;
+        
+        Node* bins[max_bins] = {};
+        size_t fill = 0;
+        Node* rest = head;
+        Node* run = nullptr;
+        Node* carry = nullptr;
+        Node* result = nullptr;
+        try {
+            while (rest != nullptr) {
+                run = rest;
+                Node* run_tail = rest;
+                rest = rest->next;
+                run->next = nullptr;
+                // Узел отцепляется от rest только после всех сравнений.
+                for (size_t taken = 1; taken < run_length && rest != nullptr; ++taken) {
+                    Node* node = rest;
+                    if (!comp(node->data, run_tail->data)) {
+                        rest = rest->next;
+                        run_tail->next = node;
+                        node->next = nullptr;
+                        run_tail = node;
+                    } else if (comp(node->data, run->data)) {
+                        rest = rest->next;
+                        node->next = run;
+                        run = node;
+                    } else {
+                        Node* pos = run;
+                        while (!comp(node->data, pos->next->data)) {
+                            pos = pos->next;
+                        }
+                        rest = rest->next;
+                        node->next = pos->next;
+                        pos->next = node;
+                    }
+                }
+                
+                carry = run;
+                run = nullptr;
+                size_t i = 0;
+                for (; i < fill && bins[i] != nullptr; ++i) {
+                    merge_nodes(bins[i], carry, comp);
+                    carry = bins[i];
+                    bins[i] = nullptr;
+                }
+                if (i == fill) {
+                    ++fill;
+                }
+                bins[i] = carry;
+                carry = nullptr;
+            }
+            
+            for (size_t i = 0; i < fill; ++i) {
+                if (bins[i] != nullptr) {
+                    if (result != nullptr) {
+                        merge_nodes(bins[i], result, comp);
+                    }
+                    result = bins[i];
+                    bins[i] = nullptr;
+                }
+            }
+        } catch (...) {
+            // Собираем в одну цепочку всё, что ещё удерживается: текущую серию,
+            // перенос, корзины, частичный результат и необработанный остаток.
+            Node* chains[max_bins + 4] = {run, carry, result, rest};
+            size_t count = 4;
+            for (size_t i = 0; i < fill; ++i) {
+                chains[count++] = bins[i];
+            }
+            head = nullptr;
+            Node** link = &head;
+            for (size_t i = 0; i < count; ++i) {
+                if (chains[i] != nullptr) {
+                    *link = chains[i];
+                    tail = last_node(chains[i]);
+                    link = &tail->next;
+                }
+            }
+            throw;
+        }
+        
+        head = result;
+        tail = last_node(result);
+    }
+    
+    void sort() {
+        sort(std::less<>());
+    }
+    
+protected:
+    // Результат слияния всегда оказывается в first, а second обнуляется; при
+    // исключении из comp в first остаются все узлы обеих цепочек.
+    template<typename Compare>
+    static void merge_nodes(Node*& first, Node*& second, Compare& comp) {
+        Node* merged = nullptr;
+        Node** link = &merged;
+        Node* left = first;
+        Node* right = second;
+        try {
+            while (left != nullptr && right != nullptr) {
+                if (comp(right->data, left->data)) {
+                    *link = right;
+                    link = &right->next;
+                    right = right->next;
+                } else {
+                    *link = left;
+                    link = &left->next;
+                    left = left->next;
+                }
+            }
+        } catch (...) {
+            *link = left;
+            while (*link != nullptr) {
+                link = &(*link)->next;
+            }
+            *link = right;
+            first = merged;
+            second = nullptr;
+            throw;
+        }
+        *link = left ? left : right;
+        first = merged;
+        second = nullptr;
+    }
+    
+    static Node* last_node(Node* node) {
+        while (node->next != nullptr) {
+            node = node->next;
+        }
+        return node;
+    }
+    
     void destroy_list() {
+        DeallocationBatch batch(fixed_block_resource_of(alloc));
         Node* current = head;
         while (current != nullptr) {
             Node* next = current->next;
-            destroy_node(current);
+            release_node(current, batch);
             current = next;
         }
+        batch.flush();
         head = nullptr;
         tail = nullptr;
         size_ = 0;
@@ -225,6 +454,13 @@ private:
         std::allocator_traits<NodeAllocator>::destroy(alloc, node);
         alloc.deallocate(node, 1);
     }
+    
+    void release_node(Node* node, DeallocationBatch& batch) {
+        std::allocator_traits<NodeAllocator>::destroy(alloc, node);
+        if (!batch.add(node)) {
+            alloc.deallocate(node, 1);
+        }
+    }
 
 public:
     using value_type = T;
@@ -297,11 +533,11 @@ public:
             return tmp;
         }
 
-        reference operator*() noexcept {
+        reference operator*() const noexcept {
             return const_cast<reference>(const_iterator::operator*());
         }
 
-        pointer operator->() noexcept {
+        pointer operator->() const noexcept {
             return const_cast<pointer>(const_iterator::operator->());
         }
     };
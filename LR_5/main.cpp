@@ -1,5 +1,6 @@
 #include <iostream>
 #include "include/singly_linked_list.h"
+#include "include/list_views.h"
 
 struct ComplexType {
     int id;
@@ -37,6 +38,14 @@ int main() {
     
     std::cout << std::endl;
     
+    std::cout << "Multiples of 20 squared (lazy views): ";
+    for (int item : intList
+            | list_views::filter([](int x) { return x % 20 == 0; })
+            | list_views::transform([](int x) { return x * x; })) {
+        std::cout << item << " ";
+    }
+    std::cout << std::endl;
+    
     std::cout << "\n--- Testing with ComplexType ---" << std::endl;
     
     SinglyLinkedList<ComplexType, std::pmr::polymorphic_allocator<ComplexType>> complexList(&pool);
@@ -1,19 +1,134 @@
 #include "../include/fixed_block_memory_resource.h"
 #include <stdexcept>
 #include <iostream>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <cstring>
 
-std::list<MemoryBlock>::iterator FixedBlockMemoryResource::find_free_block(std::size_t bytes) {
-    for (auto it = blocks.begin(); it != blocks.end(); ++it) {
-        if (it->is_free && it->size >= bytes) {
-            return it;
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && \
+    SIZE_MAX == UINT64_MAX
+#include <immintrin.h>
+#define FIXED_BLOCK_SIMD_SEARCH
+#endif
+
+namespace {
+
+using FirstFitFunction = std::size_t (*)(const std::size_t*, std::size_t, std::size_t);
+
+// Индекс первого элемента data[i] >= bytes (first-fit), начиная с from, либо count.
+std::size_t first_fit_scalar_from(const std::size_t* data, std::size_t from, std::size_t count,
+                                  std::size_t bytes) noexcept {
+    for (std::size_t i = from; i < count; ++i) {
+        if (data[i] >= bytes) {
+            return i;
+        }
+    }
+    return count;
+}
+
+std::size_t first_fit_scalar(const std::size_t* data, std::size_t count, std::size_t bytes) {
+    return first_fit_scalar_from(data, 0, count, bytes);
+}
+
+#ifdef FIXED_BLOCK_SIMD_SEARCH
+// Все значения не превышают размера пула, поэтому знаковое 64-битное сравнение
+// с (bytes - 1) эквивалентно беззнаковому data[i] >= bytes.
+__attribute__((target("avx2")))
+std::size_t first_fit_avx2(const std::size_t* data, std::size_t count, std::size_t bytes) {
+    const __m256i key = _mm256_set1_epi64x(static_cast<long long>(bytes - 1));
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(values, key)));
+        if (mask) {
+            return i + static_cast<std::size_t>(__builtin_ctz(mask));
+        }
+    }
+    return first_fit_scalar_from(data, i, count, bytes);
+}
+
+__attribute__((target("sse4.2")))
+std::size_t first_fit_sse42(const std::size_t* data, std::size_t count, std::size_t bytes) {
+    const __m128i key = _mm_set1_epi64x(static_cast<long long>(bytes - 1));
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        int mask = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(values, key)));
+        if (mask) {
+            return i + static_cast<std::size_t>(__builtin_ctz(mask));
         }
     }
-    return blocks.end();
+    return first_fit_scalar_from(data, i, count, bytes);
+}
+#endif
+
+// Реализация выбирается один раз по возможностям процессора, на котором
+// запущена программа, а не по флагам компиляции.
+FirstFitFunction select_first_fit() {
+#ifdef FIXED_BLOCK_SIMD_SEARCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return first_fit_avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return first_fit_sse42;
+    }
+#endif
+    return first_fit_scalar;
+}
+
+std::size_t first_fit(const std::size_t* data, std::size_t count, std::size_t bytes) {
+    static const FirstFitFunction implementation = select_first_fit();
+    return implementation(data, count, bytes);
+}
+
+}
+
+std::size_t FixedBlockMemoryResource::find_free_block(std::size_t bytes) const noexcept {
+    if (bytes == 0 || bytes > pool_size) {
+        return block_count();
+    }
+    return first_fit(free_sizes.data(), block_count(), bytes);
+}
+
+std::size_t FixedBlockMemoryResource::find_allocated_block(void* ptr) const {
+    std::less<void*> before;
+    if (before(ptr, pool) || !before(ptr, pool + pool_size)) {
+        throw std::invalid_argument("Invalid pointer");
+    }
+    std::size_t offset = static_cast<std::size_t>(static_cast<char*>(ptr) - pool);
+    std::size_t index = std::lower_bound(offsets.begin(), offsets.end(), offset) - offsets.begin();
+    if (index == block_count() || offsets[index] != offset || free_sizes[index] != 0 ||
+        is_arena_block(index)) {
+        throw std::invalid_argument("Invalid pointer");
+    }
+    return index;
+}
+
+std::size_t FixedBlockMemoryResource::find_allocated_block(void* ptr, std::size_t size) const {
+    std::size_t index = find_allocated_block(ptr);
+    if ((size == 0 ? 1 : size) != sizes[index]) {
+        throw std::invalid_argument("Size does not match the allocated block");
+    }
+    return index;
+}
+
+void FixedBlockMemoryResource::insert_block(std::size_t index, std::size_t offset, std::size_t size, bool is_free) {
+    offsets.insert(offsets.begin() + index, offset);
+    sizes.insert(sizes.begin() + index, size);
+    free_sizes.insert(free_sizes.begin() + index, is_free ? size : 0);
+}
+
+void FixedBlockMemoryResource::erase_block(std::size_t index) {
+    offsets.erase(offsets.begin() + index);
+    sizes.erase(sizes.begin() + index);
+    free_sizes.erase(free_sizes.begin() + index);
 }
 
 FixedBlockMemoryResource::FixedBlockMemoryResource(std::size_t size)
-    : pool(new char[size]), pool_size(size) {
-    blocks.emplace_back(pool, pool_size, true);
+    : pool(new char[size]), pool_size(size), has_arena(false), arena_offset(0), arena_end(0), bump(0) {
+    insert_block(0, 0, pool_size, true);
 }
 
 FixedBlockMemoryResource::~FixedBlockMemoryResource() {
@@ -21,28 +136,34 @@ FixedBlockMemoryResource::~FixedBlockMemoryResource() {
 }
 
 void* FixedBlockMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
-    auto free_block_it = find_free_block(bytes);
-    if (free_block_it == blocks.end()) {
+    // Блоки нулевого размера не заводятся: каждый указатель остаётся уникальным,
+    // а ненулевой free_sizes однозначно означает свободный блок.
+    if (bytes == 0) {
+        bytes = 1;
+    }
+
+    std::size_t index = find_free_block(bytes);
+    if (index == block_count()) {
         throw std::bad_alloc();
     }
 
-    void* allocated_ptr = free_block_it->ptr;
-    
-    std::size_t remaining = free_block_it->size - bytes;
+    std::size_t offset = offsets[index];
+    std::size_t remaining = sizes[index] - bytes;
+
+    sizes[index] = bytes;
+    free_sizes[index] = 0;
+
     if (remaining > 0) {
-        blocks.emplace(std::next(free_block_it), static_cast<char*>(allocated_ptr) + bytes, remaining, true);
+        insert_block(index + 1, offset + bytes, remaining, true);
     }
 
-    free_block_it->size = bytes;
-    free_block_it->is_free = false;
-
-    return allocated_ptr;
+    return pool + offset;
 }
 
 void FixedBlockMemoryResource::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) {
-    for (auto& block : blocks) {
-        if (block.ptr == ptr && !block.is_free) {
-            block.is_free = true;
+    for (std::size_t i = 0; i < block_count(); ++i) {
+        if (pool + offsets[i] == ptr && free_sizes[i] == 0 && !is_arena_block(i)) {
+            free_sizes[i] = sizes[i];
             merge_free_blocks();
             return;
         }
@@ -50,20 +171,207 @@ void FixedBlockMemoryResource::do_deallocate(void* ptr, std::size_t bytes, std::
     throw std::invalid_argument("Invalid pointer to deallocate");
 }
 
+void FixedBlockMemoryResource::deallocate_batch(void** ptrs, std::size_t count) {
+    if (count == 0) {
+        return;
+    }
+    std::sort(ptrs, ptrs + count, std::less<void*>());
+
+    std::less<void*> before;
+    std::size_t index = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if ((i > 0 && ptrs[i] == ptrs[i - 1]) ||
+            before(ptrs[i], pool) || !before(ptrs[i], pool + pool_size)) {
+            throw std::invalid_argument("Invalid pointer to deallocate");
+        }
+        std::size_t offset = static_cast<std::size_t>(static_cast<char*>(ptrs[i]) - pool);
+        index = std::lower_bound(offsets.begin() + index, offsets.end(), offset) - offsets.begin();
+        if (index == block_count() || offsets[index] != offset || free_sizes[index] != 0 ||
+            is_arena_block(index)) {
+            throw std::invalid_argument("Invalid pointer to deallocate");
+        }
+    }
+
+    index = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t offset = static_cast<std::size_t>(static_cast<char*>(ptrs[i]) - pool);
+        while (offsets[index] != offset) {
+            ++index;
+        }
+        free_sizes[index] = sizes[index];
+    }
+    merge_free_blocks();
+}
+
+void FixedBlockMemoryResource::deallocate_chain(void* first) {
+    auto next_in_chain = [](void* ptr) {
+        void* next;
+        std::memcpy(&next, ptr, sizeof(next));
+        return next;
+    };
+
+    std::size_t marked = 0;
+    try {
+        for (void* ptr = first; ptr != nullptr; ptr = next_in_chain(ptr)) {
+            std::size_t index = find_allocated_block(ptr);
+            free_sizes[index] = sizes[index];
+            ++marked;
+        }
+    } catch (const std::invalid_argument&) {
+        // Смещения блоков до слияния не менялись, поэтому отметки можно откатить.
+        for (void* ptr = first; marked > 0; ptr = next_in_chain(ptr)) {
+            std::size_t offset = static_cast<std::size_t>(static_cast<char*>(ptr) - pool);
+            std::size_t index = std::lower_bound(offsets.begin(), offsets.end(), offset) - offsets.begin();
+            free_sizes[index] = 0;
+            --marked;
+        }
+        throw std::invalid_argument("Invalid pointer to deallocate");
+    }
+    merge_free_blocks();
+}
+
+bool FixedBlockMemoryResource::try_expand(void* ptr, std::size_t old_size, std::size_t new_size) {
+    std::size_t index = find_allocated_block(ptr, old_size);
+    if (new_size < sizes[index]) {
+        shrink(ptr, old_size, new_size);
+        return true;
+    }
+    if (new_size == sizes[index]) {
+        return true;
+    }
+
+    std::size_t needed = new_size - sizes[index];
+    std::size_t next = index + 1;
+    if (next == block_count() || free_sizes[next] < needed ||
+        offsets[index] + sizes[index] != offsets[next]) {
+        return false;
+    }
+
+    sizes[index] = new_size;
+    if (sizes[next] == needed) {
+        erase_block(next);
+    } else {
+        offsets[next] += needed;
+        sizes[next] -= needed;
+        free_sizes[next] = sizes[next];
+    }
+    return true;
+}
+
+void FixedBlockMemoryResource::shrink(void* ptr, std::size_t old_size, std::size_t new_size) {
+    std::size_t index = find_allocated_block(ptr, old_size);
+    if (new_size == 0) {
+        new_size = 1;
+    }
+    if (new_size > sizes[index]) {
+        throw std::invalid_argument("Cannot shrink a block to a larger size");
+    }
+    if (new_size == sizes[index]) {
+        return;
+    }
+
+    std::size_t released = sizes[index] - new_size;
+    sizes[index] = new_size;
+    std::size_t next = index + 1;
+    if (next < block_count() && free_sizes[next] != 0) {
+        offsets[next] -= released;
+        sizes[next] += released;
+        free_sizes[next] = sizes[next];
+    } else {
+        insert_block(next, offsets[index] + new_size, released, true);
+    }
+}
+
+void FixedBlockMemoryResource::push_frame(std::size_t arena_size) {
+    if (frame_marks.empty()) {
+        if (arena_size == 0) {
+            std::size_t largest = 0;
+            for (std::size_t i = 0; i < block_count(); ++i) {
+                largest = std::max(largest, free_sizes[i]);
+            }
+            arena_size = (largest + 1) / 2;
+        }
+        std::size_t offset = 0;
+        if (arena_size != 0) {
+            offset = static_cast<std::size_t>(static_cast<char*>(do_allocate(arena_size, 1)) - pool);
+        }
+        has_arena = arena_size != 0;
+        arena_offset = offset;
+        arena_end = offset + arena_size;
+        bump = arena_offset;
+    }
+    frame_marks.push_back(bump);
+}
+
+void FixedBlockMemoryResource::pop_frame() {
+    if (frame_marks.empty()) {
+        throw std::logic_error("No frame to pop");
+    }
+    bump = frame_marks.back();
+    frame_marks.pop_back();
+
+    if (frame_marks.empty() && has_arena) {
+        std::size_t index = std::lower_bound(offsets.begin(), offsets.end(), arena_offset) - offsets.begin();
+        has_arena = false;
+        free_sizes[index] = sizes[index];
+        coalesce_around(index);
+    }
+}
+
+void* FixedBlockMemoryResource::allocate_in_frame(std::size_t bytes, std::size_t alignment) {
+    if (frame_marks.empty()) {
+        throw std::logic_error("No frame is open");
+    }
+    if (bytes == 0) {
+        bytes = 1;
+    }
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(pool + bump);
+    std::size_t padding = alignment > 1 ? static_cast<std::size_t>(-address & (alignment - 1)) : 0;
+    if (!has_arena || padding > arena_end - bump || bytes > arena_end - bump - padding) {
+        throw std::bad_alloc();
+    }
+    void* allocated_ptr = pool + bump + padding;
+    bump += padding + bytes;
+    return allocated_ptr;
+}
+
+bool FixedBlockMemoryResource::is_arena_block(std::size_t index) const noexcept {
+    return has_arena && offsets[index] == arena_offset;
+}
+
+void FixedBlockMemoryResource::coalesce_around(std::size_t index) {
+    if (index + 1 < block_count() && free_sizes[index + 1] != 0) {
+        sizes[index] += sizes[index + 1];
+        free_sizes[index] = sizes[index];
+        erase_block(index + 1);
+    }
+    if (index > 0 && free_sizes[index - 1] != 0) {
+        sizes[index - 1] += sizes[index];
+        free_sizes[index - 1] = sizes[index - 1];
+        erase_block(index);
+    }
+}
+
 bool FixedBlockMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
     return this == &other;
 }
 
 void FixedBlockMemoryResource::merge_free_blocks() {
-    auto it = blocks.begin();
-    while (it != blocks.end()) {
-        auto next_it = std::next(it);
-        if (next_it != blocks.end() && it->is_free && next_it->is_free &&
-            static_cast<char*>(it->ptr) + it->size == next_it->ptr) {
-            it->size += next_it->size;
-            blocks.erase(next_it);
+    std::size_t last = 0;
+    for (std::size_t i = 1; i < block_count(); ++i) {
+        if (free_sizes[last] != 0 && free_sizes[i] != 0 &&
+            offsets[last] + sizes[last] == offsets[i]) {
+            sizes[last] += sizes[i];
+            free_sizes[last] = sizes[last];
         } else {
-            ++it;
+            ++last;
+            offsets[last] = offsets[i];
+            sizes[last] = sizes[i];
+            free_sizes[last] = free_sizes[i];
         }
     }
-}
\ No newline at end of file
+    std::size_t count = block_count() == 0 ? 0 : last + 1;
+    offsets.resize(count);
+    sizes.resize(count);
+    free_sizes.resize(count);
+}
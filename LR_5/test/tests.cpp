@@ -1,5 +1,13 @@
 #include <gtest/gtest.h>
 #include "../include/singly_linked_list.h"
+#include "../include/list_views.h"
+#include "../include/indexed_singly_linked_list.h"
+#include "../include/concurrent_singly_linked_list.h"
+#include "../include/expandable_buffer.h"
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <random>
 
 class SinglyLinkedListTest : public ::testing::Test {
 protected:
@@ -61,6 +69,160 @@ TEST(FixedBlockMemoryResourceTest, OutOfMemoryThrows) {
     pool.deallocate(ptr2, 40, 1);
 }
 
+TEST(FixedBlockMemoryResourceTest, FirstFitAcrossManyBlocks) {
+    FixedBlockMemoryResource pool(4096);
+
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 32; ++i) {
+        ptrs.push_back(pool.allocate(16 + (i % 3) * 16, 1));
+    }
+
+    // Свободные "дыры" размером 16, 32 и 48 байт; первая подходящая под 40 байт - ptrs[11].
+    pool.deallocate(ptrs[3], 16, 1);
+    pool.deallocate(ptrs[7], 32, 1);
+    pool.deallocate(ptrs[11], 48, 1);
+    pool.deallocate(ptrs[20], 48, 1);
+
+    EXPECT_EQ(pool.allocate(40, 1), ptrs[11]);
+    EXPECT_EQ(pool.allocate(8, 1), ptrs[3]);
+    EXPECT_EQ(pool.allocate(32, 1), ptrs[7]);
+    EXPECT_EQ(pool.allocate(48, 1), ptrs[20]);
+}
+
+TEST(FixedBlockMemoryResourceTest, FirstFitMatchesReferenceModel) {
+    constexpr std::size_t pool_size = 4096;
+    FixedBlockMemoryResource pool(pool_size);
+    char* base = static_cast<char*>(pool.allocate(pool_size, 1));
+    pool.deallocate(base, pool_size, 1);
+
+    // Эталон: карта занятых байтов; first-fit - первый свободный отрезок
+    // достаточной длины (смежные свободные блоки в пуле всегда слиты).
+    std::vector<bool> used(pool_size, false);
+    auto reference_fit = [&](std::size_t bytes) -> char* {
+        std::size_t run = 0;
+        for (std::size_t i = 0; i < pool_size; ++i) {
+            run = used[i] ? 0 : run + 1;
+            if (run == bytes) {
+                return base + i + 1 - bytes;
+            }
+        }
+        return nullptr;
+    };
+
+    std::mt19937 gen(27);
+    std::uniform_int_distribution<std::size_t> size_dist(1, 96);
+    std::vector<std::pair<void*, std::size_t>> live;
+    for (int step = 0; step < 3000; ++step) {
+        if (live.empty() || gen() % 3 != 0) {
+            std::size_t bytes = size_dist(gen);
+            char* expected = reference_fit(bytes);
+            if (expected == nullptr) {
+                EXPECT_THROW(static_cast<void>(pool.allocate(bytes, 1)), std::bad_alloc);
+                continue;
+            }
+            void* ptr = pool.allocate(bytes, 1);
+            ASSERT_EQ(ptr, static_cast<void*>(expected));
+            std::fill(used.begin() + (expected - base), used.begin() + (expected - base) + bytes, true);
+            live.emplace_back(ptr, bytes);
+        } else {
+            std::size_t index = gen() % live.size();
+            auto [ptr, bytes] = live[index];
+            std::size_t offset = static_cast<char*>(ptr) - base;
+            std::fill(used.begin() + offset, used.begin() + offset + bytes, false);
+            pool.deallocate(ptr, bytes, 1);
+            live.erase(live.begin() + index);
+        }
+    }
+}
+
+TEST(FixedBlockMemoryResourceTest, ZeroByteAllocationsAreDistinct) {
+    FixedBlockMemoryResource pool(64);
+
+    void* ptr1 = pool.allocate(0, 1);
+    void* ptr2 = pool.allocate(0, 1);
+    EXPECT_NE(ptr1, ptr2);
+
+    pool.deallocate(ptr1, 0, 1);
+    pool.deallocate(ptr2, 0, 1);
+    EXPECT_NE(pool.allocate(64, 1), nullptr);
+}
+
+TEST(FixedBlockMemoryResourceTest, BatchDeallocation) {
+    FixedBlockMemoryResource pool(1024);
+
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 16; ++i) {
+        ptrs.push_back(pool.allocate(64, 1));
+    }
+    EXPECT_THROW(static_cast<void>(pool.allocate(1, 1)), std::bad_alloc);
+
+    std::vector<void*> batch(ptrs.rbegin(), ptrs.rend());
+    pool.deallocate_batch(batch.data(), batch.size());
+
+    EXPECT_EQ(pool.allocate(1024, 1), ptrs[0]);
+}
+
+TEST(FixedBlockMemoryResourceTest, BatchDeallocationRejectsInvalidPointers) {
+    FixedBlockMemoryResource pool(256);
+
+    void* ptr1 = pool.allocate(64, 1);
+    void* ptr2 = pool.allocate(64, 1);
+    int outside = 0;
+
+    void* duplicate[] = {ptr1, ptr2, ptr1};
+    EXPECT_THROW(pool.deallocate_batch(duplicate, 3), std::invalid_argument);
+
+    void* foreign[] = {ptr2, &outside};
+    EXPECT_THROW(pool.deallocate_batch(foreign, 2), std::invalid_argument);
+
+    void* misaligned[] = {static_cast<char*>(ptr1) + 1};
+    EXPECT_THROW(pool.deallocate_batch(misaligned, 1), std::invalid_argument);
+
+    // После ошибки ни один блок не был освобождён.
+    void* valid[] = {ptr2, ptr1};
+    pool.deallocate_batch(valid, 2);
+    EXPECT_THROW(pool.deallocate_batch(valid, 1), std::invalid_argument);
+}
+
+TEST(FixedBlockMemoryResourceTest, DeallocationBatchCoalescesOnce) {
+    FixedBlockMemoryResource pool(4096);
+
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 256; ++i) {
+        ptrs.push_back(pool.allocate(16, 1));
+    }
+
+    {
+        DeallocationBatch batch(&pool);
+        for (void* ptr : ptrs) {
+            EXPECT_TRUE(batch.add(ptr));
+        }
+        // Без явного flush() блоки возвращает деструктор.
+    }
+    EXPECT_EQ(pool.allocate(4096, 1), ptrs[0]);
+
+    DeallocationBatch passthrough(nullptr);
+    EXPECT_FALSE(passthrough.add(ptrs[0]));
+}
+
+TEST(FixedBlockMemoryResourceTest, DeallocationBatchRollsBackInvalidChain) {
+    FixedBlockMemoryResource pool(256);
+
+    void* ptr1 = pool.allocate(32, 1);
+    void* ptr2 = pool.allocate(32, 1);
+
+    DeallocationBatch batch(&pool);
+    batch.add(ptr1);
+    batch.add(ptr2);
+    batch.add(ptr1);
+    EXPECT_THROW(batch.flush(), std::invalid_argument);
+
+    // Ни один блок не освобождён: повторное освобождение по одному проходит.
+    pool.deallocate(ptr1, 32, 1);
+    pool.deallocate(ptr2, 32, 1);
+    EXPECT_NE(pool.allocate(256, 1), nullptr);
+}
+
 TEST_F(SinglyLinkedListTest, DefaultConstructor) {
     SinglyLinkedList<int> list;
     EXPECT_TRUE(list.empty());
@@ -343,6 +505,823 @@ TEST_F(SinglyLinkedListTest, MemoryResourceUsage) {
     EXPECT_EQ(list.size(), 5);
 }
 
+TEST_F(SinglyLinkedListTest, ViewsFilterTransformTake) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(get_allocator());
+    for (int i = 1; i <= 10; ++i) {
+        list.push_back(i);
+    }
+
+    auto view = list
+        | list_views::filter([](int x) { return x % 2 == 0; })
+        | list_views::transform([](int x) { return x * x; })
+        | list_views::take(3);
+
+    std::vector<int> elements;
+    for (int item : view) {
+        elements.push_back(item);
+    }
+    EXPECT_EQ(elements, std::vector<int>({4, 16, 36}));
+    EXPECT_EQ(list.size(), 10);
+}
+
+TEST_F(SinglyLinkedListTest, ViewsAreLazy) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(get_allocator());
+    for (int i = 1; i <= 10; ++i) {
+        list.push_back(i);
+    }
+
+    int calls = 0;
+    auto view = list
+        | list_views::transform([&calls](int x) { ++calls; return x + 1; })
+        | list_views::take(2);
+    EXPECT_EQ(calls, 0);
+
+    int sum = 0;
+    for (int item : view) {
+        sum += item;
+    }
+    EXPECT_EQ(sum, 5);
+    EXPECT_EQ(calls, 2);
+}
+
+TEST_F(SinglyLinkedListTest, ViewsFilterModifiesInPlace) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(get_allocator());
+    for (int i = 1; i <= 5; ++i) {
+        list.push_back(i);
+    }
+
+    for (int& item : list | list_views::filter([](int x) { return x > 3; })) {
+        item = 0;
+    }
+
+    std::vector<int> elements(list.begin(), list.end());
+    EXPECT_EQ(elements, std::vector<int>({1, 2, 3, 0, 0}));
+}
+
+TEST_F(SinglyLinkedListTest, ViewsChunk) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(get_allocator());
+    for (int i = 1; i <= 7; ++i) {
+        list.push_back(i);
+    }
+
+    const auto& const_list = list;
+    std::vector<int> sums;
+    std::vector<std::size_t> sizes;
+    for (auto chunk : const_list | list_views::chunk(3)) {
+        int sum = 0;
+        for (int item : chunk) {
+            sum += item;
+        }
+        sums.push_back(sum);
+        sizes.push_back(chunk.size());
+    }
+    EXPECT_EQ(sums, std::vector<int>({6, 15, 7}));
+    EXPECT_EQ(sizes, std::vector<std::size_t>({3, 3, 1}));
+
+    EXPECT_THROW(static_cast<void>(list | list_views::chunk(0)), std::invalid_argument);
+}
+
+TEST_F(SinglyLinkedListTest, ViewsOnEmptyList) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(get_allocator());
+
+    auto view = list | list_views::filter([](int) { return true; }) | list_views::take(5);
+    EXPECT_TRUE(view.begin() == view.end());
+
+    auto chunks = list | list_views::chunk(2);
+    EXPECT_TRUE(chunks.begin() == chunks.end());
+}
+
+struct TestStructId {
+    int operator()(const TestStruct& item) const noexcept {
+        return item.id;
+    }
+};
+
+TEST(IndexedSinglyLinkedListTest, FindContainsErase) {
+    FixedBlockMemoryResource pool(16384);
+    IndexedSinglyLinkedList<int> list(&pool);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(list.push_back(i).second);
+    }
+    EXPECT_EQ(list.size(), 100);
+
+    EXPECT_TRUE(list.contains(42));
+    EXPECT_EQ(*list.find(42), 42);
+    EXPECT_EQ(list.find(1000), list.end());
+
+    EXPECT_TRUE(list.erase(42));
+    EXPECT_FALSE(list.erase(42));
+    EXPECT_FALSE(list.contains(42));
+    EXPECT_TRUE(list.contains(43));
+    EXPECT_EQ(list.size(), 99);
+
+    for (int i = 0; i < 100; i += 2) {
+        list.erase(i);
+    }
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 99);
+
+    int expected = 1;
+    for (int item : list) {
+        EXPECT_EQ(item, expected);
+        expected += 2;
+    }
+    EXPECT_EQ(expected, 101);
+}
+
+TEST(IndexedSinglyLinkedListTest, DuplicateKeysRejected) {
+    FixedBlockMemoryResource pool(2048);
+    IndexedSinglyLinkedList<int> list(&pool);
+
+    list.push_back(1);
+    list.push_front(0);
+    auto result = list.push_back(1);
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(*result.first, 1);
+    EXPECT_FALSE(list.push_front(0).second);
+    EXPECT_EQ(list.size(), 2);
+}
+
+TEST(IndexedSinglyLinkedListTest, PushFrontPopBackKeepsIndex) {
+    FixedBlockMemoryResource pool(4096);
+    IndexedSinglyLinkedList<int> list(&pool);
+
+    for (int i = 0; i < 20; ++i) {
+        list.push_front(i);
+    }
+    list.pop_back();
+    list.pop_front();
+    EXPECT_EQ(list.front(), 18);
+    EXPECT_EQ(list.back(), 1);
+
+    EXPECT_TRUE(list.erase(1));
+    EXPECT_EQ(list.back(), 2);
+    EXPECT_TRUE(list.erase(18));
+    EXPECT_EQ(list.front(), 17);
+    EXPECT_TRUE(list.erase(10));
+    list.push_back(100);
+
+    std::vector<int> elements(list.begin(), list.end());
+    EXPECT_EQ(elements, std::vector<int>({17, 16, 15, 14, 13, 12, 11, 9, 8, 7, 6, 5, 4, 3, 2, 100}));
+
+    while (!list.empty()) {
+        list.pop_back();
+    }
+    EXPECT_FALSE(list.contains(100));
+    EXPECT_THROW(list.pop_back(), std::out_of_range);
+}
+
+TEST(IndexedSinglyLinkedListTest, KeyExtractorAndUpdate) {
+    FixedBlockMemoryResource pool(8192);
+    IndexedSinglyLinkedList<TestStruct, TestStructId> list{
+        std::pmr::polymorphic_allocator<TestStruct>(&pool)};
+
+    list.push_back(TestStruct(1, 1.1, "first"));
+    list.push_back(TestStruct(2, 2.2, "second"));
+    list.push_back(TestStruct(3, 3.3, "third"));
+
+    auto it = list.find(2);
+    ASSERT_NE(it, list.end());
+    it->value = 20.0;
+    EXPECT_EQ(list.find(2)->value, 20.0);
+
+    IndexedSinglyLinkedList<TestStruct, TestStructId> copy(list);
+    EXPECT_TRUE(list.erase(2));
+    EXPECT_TRUE(copy.contains(2));
+    EXPECT_EQ(copy.size(), 3);
+
+    IndexedSinglyLinkedList<TestStruct, TestStructId> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.find(3)->name, "third");
+}
+
+TEST(IndexedSinglyLinkedListTest, StridedKeys) {
+    FixedBlockMemoryResource pool(1 << 22);
+    IndexedSinglyLinkedList<long long> list{std::pmr::polymorphic_allocator<long long>(&pool)};
+
+    // std::hash<long long> - тождественная функция, поэтому без перемешивания
+    // все ключи с шагом 2^20 попадали бы в одну позицию таблицы.
+    const long long count = 20000;
+    for (long long i = 0; i < count; ++i) {
+        EXPECT_TRUE(list.push_back(i << 20).second);
+    }
+    for (long long i = 0; i < count; i += 100) {
+        EXPECT_TRUE(list.erase(i << 20));
+    }
+    for (long long i = 0; i < count; ++i) {
+        EXPECT_EQ(list.contains(i << 20), i % 100 != 0);
+    }
+    EXPECT_EQ(*list.find(7 << 20), 7 << 20);
+    EXPECT_FALSE(list.push_back(1 << 20).second);
+    EXPECT_EQ(list.size(), static_cast<size_t>(count - count / 100));
+}
+
+TEST(ConcurrentSinglyLinkedListTest, BasicOperations) {
+    FixedBlockMemoryResource pool(4096);
+    ConcurrentSinglyLinkedList<int> list(&pool);
+    auto reader = list.register_reader();
+
+    list.push_back(2);
+    list.push_back(3);
+    list.push_front(1);
+    EXPECT_EQ(list.size(), 3);
+
+    {
+        auto guard = reader.pin();
+        std::vector<int> elements(guard.begin(), guard.end());
+        EXPECT_EQ(elements, std::vector<int>({1, 2, 3}));
+    }
+
+    EXPECT_EQ(list.remove_if([](int x) { return x % 2 == 1; }), 2);
+    list.push_back(4);
+    list.pop_front();
+    {
+        auto guard = reader.pin();
+        std::vector<int> elements(guard.begin(), guard.end());
+        EXPECT_EQ(elements, std::vector<int>({4}));
+    }
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.retired_count(), 0);
+    EXPECT_THROW(list.pop_front(), std::out_of_range);
+}
+
+TEST(ConcurrentSinglyLinkedListTest, PinnedReaderDelaysReclamation) {
+    FixedBlockMemoryResource pool(4096);
+    ConcurrentSinglyLinkedList<int> list(&pool);
+    auto reader = list.register_reader();
+
+    for (int i = 1; i <= 3; ++i) {
+        list.push_back(i);
+    }
+
+    {
+        auto guard = reader.pin();
+        auto it = guard.begin();
+        EXPECT_EQ(*it, 1);
+
+        list.pop_front();
+        list.remove_if([](int x) { return x == 2; });
+        EXPECT_EQ(list.retired_count(), 2);
+
+        // Удалённые узлы ещё живы: читатель продолжает обход по старым ссылкам.
+        ++it;
+        EXPECT_EQ(*it, 2);
+        ++it;
+        EXPECT_EQ(*it, 3);
+    }
+
+    list.reclaim();
+    EXPECT_EQ(list.retired_count(), 0);
+
+    auto guard = reader.pin();
+    std::vector<int> elements(guard.begin(), guard.end());
+    EXPECT_EQ(elements, std::vector<int>({3}));
+}
+
+TEST(ConcurrentSinglyLinkedListTest, ReaderSlotsAreLimited) {
+    FixedBlockMemoryResource pool(1024);
+    ConcurrentSinglyLinkedList<int> list(&pool, 2);
+
+    auto reader1 = list.register_reader();
+    {
+        auto reader2 = list.register_reader();
+        EXPECT_THROW(static_cast<void>(list.register_reader()), std::length_error);
+    }
+    EXPECT_NO_THROW(static_cast<void>(list.register_reader()));
+}
+
+TEST(ConcurrentSinglyLinkedListTest, ConcurrentReadersAndWriter) {
+    FixedBlockMemoryResource pool(65536);
+    ConcurrentSinglyLinkedList<int> list(&pool);
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+    }
+
+    std::atomic<bool> done(false);
+    std::atomic<int> bad_reads(0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            auto reader = list.register_reader();
+            while (!done.load()) {
+                auto guard = reader.pin();
+                int previous = -1;
+                for (int item : guard) {
+                    if (item <= previous) {
+                        bad_reads.fetch_add(1);
+                    }
+                    previous = item;
+                }
+            }
+        });
+    }
+
+    for (int i = 100; i < 2100; ++i) {
+        list.push_back(i);
+        list.pop_front();
+    }
+    done.store(true);
+    for (auto& thread : readers) {
+        thread.join();
+    }
+
+    list.reclaim();
+    EXPECT_EQ(bad_reads.load(), 0);
+    EXPECT_EQ(list.size(), 100);
+    EXPECT_EQ(list.retired_count(), 0);
+}
+
+TEST_F(SinglyLinkedListTest, ClearReturnsAllMemory) {
+    FixedBlockMemoryResource big_pool(65536);
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list{
+        std::pmr::polymorphic_allocator<int>(&big_pool)};
+
+    for (int i = 0; i < 1000; ++i) {
+        list.push_back(i);
+    }
+    list.clear();
+
+    void* whole = big_pool.allocate(65536, 1);
+    EXPECT_NE(whole, nullptr);
+    big_pool.deallocate(whole, 65536, 1);
+}
+
+TEST_F(SinglyLinkedListTest, Reverse) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(get_allocator());
+    list.reverse();
+    EXPECT_TRUE(list.empty());
+
+    for (int i = 1; i <= 5; ++i) {
+        list.push_back(i);
+    }
+    list.reverse();
+    list.push_back(0);
+
+    std::vector<int> elements(list.begin(), list.end());
+    EXPECT_EQ(elements, std::vector<int>({5, 4, 3, 2, 1, 0}));
+    EXPECT_EQ(list.front(), 5);
+    EXPECT_EQ(list.back(), 0);
+}
+
+TEST_F(SinglyLinkedListTest, Unique) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(get_allocator());
+    for (int item : {1, 1, 2, 3, 3, 3, 1, 4, 4}) {
+        list.push_back(item);
+    }
+
+    EXPECT_EQ(list.unique(), 4);
+    EXPECT_EQ(list.size(), 5);
+    EXPECT_EQ(list.back(), 4);
+
+    std::vector<int> elements(list.begin(), list.end());
+    EXPECT_EQ(elements, std::vector<int>({1, 2, 3, 1, 4}));
+
+    list.push_back(5);
+    EXPECT_EQ(list.unique([](int a, int b) { return b == a + 1; }), 2);
+    elements.assign(list.begin(), list.end());
+    EXPECT_EQ(elements, std::vector<int>({1, 3, 1, 4}));
+    EXPECT_EQ(list.back(), 4);
+}
+
+TEST_F(SinglyLinkedListTest, SortMatchesStableSort) {
+    FixedBlockMemoryResource big_pool(1 << 20);
+    SinglyLinkedList<std::pair<int, int>, std::pmr::polymorphic_allocator<std::pair<int, int>>> list{
+        std::pmr::polymorphic_allocator<std::pair<int, int>>(&big_pool)};
+
+    std::mt19937 gen(13);
+    std::uniform_int_distribution<int> dist(0, 50);
+    std::vector<std::pair<int, int>> expected;
+    for (int i = 0; i < 5000; ++i) {
+        expected.emplace_back(dist(gen), i);
+        list.push_back(expected.back());
+    }
+
+    auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+    list.sort(by_key);
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+
+    std::vector<std::pair<int, int>> elements(list.begin(), list.end());
+    EXPECT_EQ(elements, expected);
+    EXPECT_EQ(list.back(), expected.back());
+    EXPECT_EQ(list.size(), 5000);
+}
+
+TEST_F(SinglyLinkedListTest, SortDoesNotAllocate) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(get_allocator());
+    while (true) {
+        try {
+            list.push_front(static_cast<int>(list.size()));
+        } catch (const std::bad_alloc&) {
+            break;
+        }
+    }
+    size_t count = list.size();
+
+    list.sort();
+    EXPECT_EQ(list.size(), count);
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), static_cast<int>(count) - 1);
+
+    list.sort(std::greater<>());
+    EXPECT_EQ(list.front(), static_cast<int>(count) - 1);
+}
+
+TEST_F(SinglyLinkedListTest, Merge) {
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list1(get_allocator());
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list2(get_allocator());
+    for (int item : {1, 4, 6}) {
+        list1.push_back(item);
+    }
+    for (int item : {2, 4, 7, 9}) {
+        list2.push_back(item);
+    }
+
+    list1.merge(list2);
+    EXPECT_TRUE(list2.empty());
+    EXPECT_EQ(list1.size(), 7);
+    EXPECT_EQ(list1.back(), 9);
+
+    std::vector<int> elements(list1.begin(), list1.end());
+    EXPECT_EQ(elements, std::vector<int>({1, 2, 4, 4, 6, 7, 9}));
+
+    list2.push_back(10);
+    list1.merge(list2);
+    list1.push_back(11);
+    EXPECT_EQ(list1.size(), 9);
+    EXPECT_EQ(list1.back(), 11);
+
+    FixedBlockMemoryResource other_pool(256);
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> foreign{
+        std::pmr::polymorphic_allocator<int>(&other_pool)};
+    foreign.push_back(3);
+    EXPECT_THROW(list1.merge(foreign), std::invalid_argument);
+}
+
+TEST_F(SinglyLinkedListTest, ThrowingComparatorKeepsAllNodes) {
+    FixedBlockMemoryResource big_pool(16384);
+    std::pmr::polymorphic_allocator<int> big_alloc(&big_pool);
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(big_alloc);
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> other(big_alloc);
+    auto reachable = [](const SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>>& l) {
+        return static_cast<size_t>(std::distance(l.begin(), l.end()));
+    };
+
+    std::mt19937 gen(21);
+    std::uniform_int_distribution<int> dist(0, 1000);
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(dist(gen));
+    }
+
+    for (int limit : {1, 5, 17, 150, 300}) {
+        int calls = 0;
+        auto comp = [&calls, limit](int a, int b) {
+            if (++calls == limit) {
+                throw std::runtime_error("comparator failed");
+            }
+            return a < b;
+        };
+        EXPECT_THROW(list.sort(comp), std::runtime_error);
+        EXPECT_EQ(list.size(), 100);
+        EXPECT_EQ(reachable(list), list.size());
+    }
+
+    list.sort();
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+    for (int i = 0; i < 50; ++i) {
+        other.push_back(i * 20);
+    }
+    int calls = 0;
+    EXPECT_THROW(list.merge(other, [&calls](int a, int b) {
+        if (++calls == 40) {
+            throw std::runtime_error("comparator failed");
+        }
+        return a < b;
+    }), std::runtime_error);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(list.size(), 150);
+    EXPECT_EQ(reachable(list), list.size());
+
+    list.push_back(2000);
+    EXPECT_EQ(list.back(), 2000);
+    EXPECT_EQ(reachable(list), 151);
+
+    list.clear();
+    void* whole = big_pool.allocate(16384, 1);
+    EXPECT_NE(whole, nullptr);
+    big_pool.deallocate(whole, 16384, 1);
+}
+
+TEST(FixedBlockMemoryResourceTest, TryExpandAndShrink) {
+    FixedBlockMemoryResource pool(256);
+
+    void* ptr1 = pool.allocate(32, 1);
+    EXPECT_TRUE(pool.try_expand(ptr1, 32, 64));
+    EXPECT_TRUE(pool.try_expand(ptr1, 64, 64));
+    // Уменьшение через try_expand выполняется как shrink.
+    EXPECT_TRUE(pool.try_expand(ptr1, 64, 48));
+
+    void* ptr2 = pool.allocate(64, 1);
+    EXPECT_EQ(ptr2, static_cast<char*>(ptr1) + 48);
+    EXPECT_FALSE(pool.try_expand(ptr1, 48, 49));
+
+    EXPECT_TRUE(pool.try_expand(ptr2, 64, 208));
+    EXPECT_THROW(static_cast<void>(pool.allocate(1, 1)), std::bad_alloc);
+
+    pool.shrink(ptr2, 208, 100);
+    void* ptr3 = pool.allocate(92, 1);
+    EXPECT_EQ(ptr3, static_cast<char*>(ptr2) + 100);
+
+    pool.deallocate(ptr3, 92, 1);
+    pool.shrink(ptr2, 100, 64);
+    EXPECT_EQ(pool.allocate(128, 1), static_cast<void*>(static_cast<char*>(ptr2) + 64));
+
+    int outside = 0;
+    EXPECT_THROW(pool.try_expand(&outside, 4, 8), std::invalid_argument);
+    EXPECT_THROW(pool.shrink(static_cast<char*>(ptr1) + 1, 4, 2), std::invalid_argument);
+    EXPECT_THROW(pool.try_expand(ptr1, 32, 40), std::invalid_argument);
+    EXPECT_THROW(pool.shrink(ptr2, 100, 32), std::invalid_argument);
+    EXPECT_THROW(pool.shrink(ptr2, 64, 80), std::invalid_argument);
+}
+
+TEST(ExpandableBufferTest, GrowsInPlace) {
+    FixedBlockMemoryResource pool(4096);
+    ExpandableBuffer<int> buffer(&pool);
+
+    buffer.push_back(0);
+    int* initial = buffer.data();
+    for (int i = 1; i < 100; ++i) {
+        buffer.push_back(i);
+    }
+    EXPECT_EQ(buffer.data(), initial);
+    EXPECT_EQ(buffer.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(buffer[i], i);
+    }
+
+    buffer.shrink_to_fit();
+    EXPECT_EQ(buffer.capacity(), 100);
+    void* next = pool.allocate(16, 1);
+    EXPECT_EQ(next, static_cast<void*>(initial + 100));
+    pool.deallocate(next, 16, 1);
+}
+
+TEST(ExpandableBufferTest, FallsBackToReallocation) {
+    FixedBlockMemoryResource pool(8192);
+    ExpandableBuffer<TestStruct> buffer{std::pmr::polymorphic_allocator<TestStruct>(&pool)};
+
+    buffer.push_back(TestStruct(1, 1.0, "first"));
+    TestStruct* initial = buffer.data();
+    void* blocker = pool.allocate(8, 1);
+
+    buffer.push_back(TestStruct(2, 2.0, "second"));
+    EXPECT_NE(buffer.data(), initial);
+    EXPECT_EQ(buffer.front().name, "first");
+    EXPECT_EQ(buffer.back().name, "second");
+    pool.deallocate(blocker, 8, 1);
+
+    ExpandableBuffer<TestStruct> copy(buffer);
+    buffer.pop_back();
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(buffer.size(), 1);
+    EXPECT_THROW(buffer.at(1), std::out_of_range);
+
+    ExpandableBuffer<TestStruct> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.at(1).id, 2);
+}
+
+TEST(FixedBlockMemoryResourceTest, FramesReleaseAllocationsSinceMark) {
+    FixedBlockMemoryResource pool(1024);
+    FrameResource frame(pool);
+
+    void* long_lived = pool.allocate(100, 1);
+    EXPECT_THROW(static_cast<void>(frame.allocate(8, 1)), std::logic_error);
+    {
+        FrameGuard request(pool);
+        EXPECT_EQ(pool.frame_depth(), 1);
+
+        void* ptr1 = frame.allocate(64, 8);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr1) % 8, 0);
+        frame.deallocate(ptr1, 64, 8);
+
+        pool.push_frame();
+        void* ptr2 = frame.allocate(128, 1);
+        EXPECT_NE(ptr2, ptr1);
+        pool.pop_frame();
+
+        void* ptr3 = frame.allocate(128, 1);
+        EXPECT_EQ(ptr3, ptr2);
+        EXPECT_THROW(static_cast<void>(frame.allocate(1024, 1)), std::bad_alloc);
+
+        pool.deallocate(long_lived, 100, 1);
+    }
+    EXPECT_EQ(pool.frame_depth(), 0);
+    EXPECT_THROW(pool.pop_frame(), std::logic_error);
+
+    void* whole = pool.allocate(1024, 1);
+    EXPECT_NE(whole, nullptr);
+    pool.deallocate(whole, 1024, 1);
+}
+
+TEST(FixedBlockMemoryResourceTest, FramesKeepLongLivedAllocations) {
+    FixedBlockMemoryResource pool(1024);
+    FrameResource frame(pool);
+
+    void* before = pool.allocate(64, 1);
+    pool.push_frame(256);
+    void* inside = frame.allocate(64, 1);
+    void* during = pool.allocate(64, 1);
+    EXPECT_THROW(pool.deallocate(inside, 64, 1), std::invalid_argument);
+    pool.pop_frame();
+
+    // Обычное выделение во время кадра переживает pop_frame.
+    std::memset(during, 0x5a, 64);
+    EXPECT_THROW(static_cast<void>(pool.allocate(1024 - 127, 1)), std::bad_alloc);
+    pool.deallocate(before, 64, 1);
+    pool.deallocate(during, 64, 1);
+    EXPECT_NE(pool.allocate(1024, 1), nullptr);
+}
+
+TEST(FixedBlockMemoryResourceTest, FrameArenaDoesNotCaptureExistingContainers) {
+    FixedBlockMemoryResource pool(4096);
+    ExpandableBuffer<int> buffer{std::pmr::polymorphic_allocator<int>(&pool)};
+    buffer.push_back(1);
+
+    {
+        FrameGuard request(pool, 1024);
+        FrameResource frame(pool);
+        ExpandableBuffer<int> temp{std::pmr::polymorphic_allocator<int>(&frame)};
+        for (int i = 2; i <= 100; ++i) {
+            buffer.push_back(i);
+            temp.push_back(i);
+        }
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(buffer[i], i + 1);
+    }
+    void* ptr = pool.allocate(1024, 1);
+    EXPECT_NE(ptr, nullptr);
+    pool.deallocate(ptr, 1024, 1);
+}
+
+TEST_F(SinglyLinkedListTest, ListsInsideFrame) {
+    FixedBlockMemoryResource request_pool(65536);
+    FrameResource frame_pool(request_pool);
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> config{
+        std::pmr::polymorphic_allocator<int>(&request_pool)};
+    config.push_back(42);
+
+    for (int request = 0; request < 3; ++request) {
+        FrameGuard frame(request_pool);
+        SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> temp1{
+            std::pmr::polymorphic_allocator<int>(&frame_pool)};
+        IndexedSinglyLinkedList<int> temp2{std::pmr::polymorphic_allocator<int>(&frame_pool)};
+        for (int i = 0; i < 100; ++i) {
+            temp1.push_back(i);
+            temp2.push_back(i);
+        }
+        temp1.sort(std::greater<>());
+        EXPECT_EQ(temp1.front(), 99);
+        EXPECT_TRUE(temp2.erase(50));
+        config.push_back(request);
+    }
+
+    EXPECT_EQ(config.size(), 4);
+    EXPECT_EQ(config.front(), 42);
+    config.clear();
+    EXPECT_NE(request_pool.allocate(65536, 1), nullptr);
+}
+
+TEST_F(SinglyLinkedListTest, NestedFramesScopeContainers) {
+    FixedBlockMemoryResource request_pool(8192);
+    FrameResource frame_pool(request_pool);
+    {
+        FrameGuard outer(request_pool);
+        SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> outer_list{
+            std::pmr::polymorphic_allocator<int>(&frame_pool)};
+        outer_list.push_back(1);
+        {
+            FrameGuard inner(request_pool);
+            SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> inner_list{
+                std::pmr::polymorphic_allocator<int>(&frame_pool)};
+            for (int i = 0; i < 10; ++i) {
+                inner_list.push_back(i);
+            }
+            EXPECT_EQ(inner_list.size(), 10);
+        }
+        EXPECT_EQ(request_pool.frame_depth(), 1);
+
+        // Узлы внешнего списка лежат ниже отметки вложенного кадра и не перезаписываются.
+        for (int i = 2; i <= 10; ++i) {
+            outer_list.push_back(i);
+        }
+        std::vector<int> elements(outer_list.begin(), outer_list.end());
+        EXPECT_EQ(elements, std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    }
+    EXPECT_EQ(request_pool.frame_depth(), 0);
+    EXPECT_NE(request_pool.allocate(8192, 1), nullptr);
+}
+
+TEST(FixedBlockMemoryResourceTest, DefaultFrameLeavesRoomForPool) {
+    FixedBlockMemoryResource pool(1024);
+    FrameResource frame(pool);
+    {
+        FrameGuard request(pool);
+        void* ordinary = pool.allocate(400, 1);
+        EXPECT_NE(ordinary, nullptr);
+        EXPECT_NE(frame.allocate(400, 1), nullptr);
+        EXPECT_THROW(static_cast<void>(frame.allocate(200, 1)), std::bad_alloc);
+        pool.deallocate(ordinary, 400, 1);
+    }
+    EXPECT_NE(pool.allocate(1024, 1), nullptr);
+}
+
+TEST(IndexedSinglyLinkedListTest, MoveAssignAcrossResources) {
+    FixedBlockMemoryResource pool_a(4096);
+    FixedBlockMemoryResource pool_b(4096);
+    IndexedSinglyLinkedList<int> list_a(&pool_a);
+    IndexedSinglyLinkedList<int> list_b(&pool_b);
+    IndexedSinglyLinkedList<int> list_c(&pool_a);
+
+    list_a.push_back(100);
+    for (int i = 0; i < 20; ++i) {
+        list_b.push_back(i);
+        list_c.push_back(i * 2);
+    }
+
+    list_a = std::move(list_b);
+    EXPECT_TRUE(list_b.empty());
+    EXPECT_EQ(list_a.size(), 20);
+    EXPECT_TRUE(list_a.contains(19));
+    EXPECT_FALSE(list_a.contains(100));
+    EXPECT_TRUE(list_a.erase(7));
+
+    IndexedSinglyLinkedList<int> list_d(&pool_a);
+    list_d = std::move(list_c);
+    EXPECT_TRUE(list_c.empty());
+    EXPECT_TRUE(list_d.contains(38));
+    list_c.push_back(1);
+    EXPECT_TRUE(list_c.contains(1));
+}
+
+TEST_F(SinglyLinkedListTest, MoveAssignAcrossResources) {
+    FixedBlockMemoryResource other_pool(1024);
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list1(get_allocator());
+    SinglyLinkedList<int, std::pmr::polymorphic_allocator<int>> list2{
+        std::pmr::polymorphic_allocator<int>(&other_pool)};
+    list2.push_back(1);
+    list2.push_back(2);
+
+    list1 = std::move(list2);
+    EXPECT_TRUE(list2.empty());
+    std::vector<int> elements(list1.begin(), list1.end());
+    EXPECT_EQ(elements, std::vector<int>({1, 2}));
+}
+
+TEST(ExpandableBufferTest, ReserveBeyondMaxSizeThrows) {
+    FixedBlockMemoryResource pool(1024);
+    ExpandableBuffer<int> buffer{std::pmr::polymorphic_allocator<int>(&pool)};
+    for (int i = 0; i < 4; ++i) {
+        buffer.push_back(i);
+    }
+
+    EXPECT_THROW(buffer.reserve(buffer.max_size() + 1), std::length_error);
+    EXPECT_THROW(buffer.reserve(SIZE_MAX / sizeof(int) + 2), std::length_error);
+    EXPECT_EQ(buffer.capacity(), 4);
+    buffer.push_back(4);
+    EXPECT_EQ(buffer.back(), 4);
+    EXPECT_EQ(buffer.size(), 5);
+}
+
+TEST(ExpandableBufferTest, MoveAssignAcrossResources) {
+    FixedBlockMemoryResource pool_a(4096);
+    FixedBlockMemoryResource pool_b(4096);
+    ExpandableBuffer<TestStruct> buffer_a{std::pmr::polymorphic_allocator<TestStruct>(&pool_a)};
+    ExpandableBuffer<TestStruct> buffer_b{std::pmr::polymorphic_allocator<TestStruct>(&pool_b)};
+
+    buffer_a.push_back(TestStruct(0, 0.0, "old"));
+    for (int i = 1; i <= 5; ++i) {
+        buffer_b.push_back(TestStruct(i, i * 1.0, "item"));
+    }
+
+    buffer_a = std::move(buffer_b);
+    EXPECT_TRUE(buffer_b.empty());
+    EXPECT_EQ(buffer_a.size(), 5);
+    EXPECT_EQ(buffer_a.back().id, 5);
+    buffer_a.push_back(TestStruct(6, 6.0, "new"));
+
+    ExpandableBuffer<TestStruct> buffer_c{std::pmr::polymorphic_allocator<TestStruct>(&pool_a)};
+    TestStruct* storage = buffer_a.data();
+    buffer_c = std::move(buffer_a);
+    EXPECT_EQ(buffer_c.data(), storage);
+    EXPECT_EQ(buffer_c.size(), 6);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();